@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <bitcoin/system.hpp>
+
+namespace benchmark {
+
+using namespace std::chrono;
+typedef steady_clock timer;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+runner::runner(const std::string& filter, size_t rounds,
+    size_t warmup) NOEXCEPT
+  : filter_(filter), rounds_(std::max(rounds, one)), warmup_(warmup)
+{
+}
+
+void runner::add(const std::string& suite, const std::string& name,
+    setup&& factory) NOEXCEPT
+{
+    entries_.push_back({ suite, name, std::move(factory) });
+}
+
+result::list runner::run(std::ostream& log) const NOEXCEPT
+{
+    result::list results{};
+    for (const auto& entry: entries_)
+    {
+        const auto path = entry.suite + "/" + entry.name;
+        if (path.find(filter_) == std::string::npos)
+            continue;
+
+        log << entry.suite << "/" << entry.name << std::endl;
+        results.push_back(measure(entry));
+    }
+
+    return results;
+}
+
+result runner::measure(const entry& benchmark) const NOEXCEPT
+{
+    const auto work = benchmark.factory();
+
+    size_t check{};
+    for (size_t round = 0; round < warmup_; ++round)
+        check += work.function();
+
+    // Each round is timed independently, the median rejects outliers.
+    check = zero;
+    std::vector<uint64_t> times(rounds_);
+    for (auto& time: times)
+    {
+        const auto start = timer::now();
+        check += work.function();
+        time = sign_cast<uint64_t>(
+            duration_cast<nanoseconds>(timer::now() - start).count());
+    }
+
+    auto sorted = times;
+    std::sort(sorted.begin(), sorted.end());
+
+    uint64_t total{};
+    for (const auto time: times)
+        total += time;
+
+    return
+    {
+        benchmark.suite,
+        benchmark.name,
+        work.items,
+        work.bytes,
+        rounds_,
+        sorted.front(),
+        sorted.at(to_half(sorted.size())),
+        total,
+        check
+    };
+}
+
+// write
+// ----------------------------------------------------------------------------
+
+static double per_second(size_t count, uint64_t nanoseconds) NOEXCEPT
+{
+    constexpr auto giga = 1000.0 * 1000.0 * 1000.0;
+    return is_zero(nanoseconds) ? 0.0 : (giga * count) / nanoseconds;
+}
+
+static double mib_per_second(size_t bytes, uint64_t nanoseconds) NOEXCEPT
+{
+    return per_second(bytes, nanoseconds) / power2(20u);
+}
+
+static double nanoseconds_per(size_t count, uint64_t nanoseconds) NOEXCEPT
+{
+    return is_zero(count) ? 0.0 : (1.0 * nanoseconds) / count;
+}
+
+static boost::json::object environment() NOEXCEPT
+{
+    return
+    {
+        { "library", LIBBITCOIN_SYSTEM_VERSION },
+        { "with_shani", with_shani },
+        { "with_avx512", with_avx512 },
+        { "with_avx2", with_avx2 },
+        { "with_sse41", with_sse41 },
+        { "have_shani", have_shani() },
+        { "have_avx512", have_avx512() },
+        { "have_avx2", have_avx2() },
+        { "have_sse41", have_sse41() }
+    };
+}
+
+static void write_text(std::ostream& out,
+    const result::list& results) NOEXCEPT
+{
+    out << std::left << std::setw(40) << "benchmark"
+        << std::right << std::setw(14) << "median_ns"
+        << std::setw(14) << "ns_per_item"
+        << std::setw(16) << "items_per_sec"
+        << std::setw(12) << "mib_per_sec" << std::endl;
+
+    out << std::fixed << std::setprecision(2);
+    for (const auto& result: results)
+    {
+        out << std::left << std::setw(40) << (result.suite + "/" + result.name)
+            << std::right << std::setw(14) << result.median
+            << std::setw(14) << nanoseconds_per(result.items, result.median)
+            << std::setw(16) << per_second(result.items, result.median)
+            << std::setw(12) << mib_per_second(result.bytes, result.median)
+            << std::endl;
+    }
+}
+
+static void write_csv(std::ostream& out, const result::list& results) NOEXCEPT
+{
+    out << "suite,name,items,bytes,rounds,minimum_ns,median_ns,total_ns,"
+        "ns_per_item,items_per_second,mib_per_second,check" << std::endl;
+
+    out << std::fixed << std::setprecision(3);
+    for (const auto& result: results)
+    {
+        out << result.suite << ","
+            << result.name << ","
+            << result.items << ","
+            << result.bytes << ","
+            << result.rounds << ","
+            << result.minimum << ","
+            << result.median << ","
+            << result.total << ","
+            << nanoseconds_per(result.items, result.median) << ","
+            << per_second(result.items, result.median) << ","
+            << mib_per_second(result.bytes, result.median) << ","
+            << result.check << std::endl;
+    }
+}
+
+static void write_json(std::ostream& out,
+    const result::list& results) NOEXCEPT
+{
+    boost::json::array values{};
+    for (const auto& result: results)
+    {
+        values.push_back(boost::json::object
+        {
+            { "suite", result.suite },
+            { "name", result.name },
+            { "items", result.items },
+            { "bytes", result.bytes },
+            { "rounds", result.rounds },
+            { "minimum_ns", result.minimum },
+            { "median_ns", result.median },
+            { "total_ns", result.total },
+            { "ns_per_item", nanoseconds_per(result.items, result.median) },
+            { "items_per_second", per_second(result.items, result.median) },
+            { "mib_per_second", mib_per_second(result.bytes, result.median) },
+            { "check", result.check }
+        });
+    }
+
+    out << boost::json::serialize(boost::json::object
+    {
+        { "environment", environment() },
+        { "results", std::move(values) }
+    }) << std::endl;
+}
+
+void write(std::ostream& out, const result::list& results,
+    format type) NOEXCEPT
+{
+    switch (type)
+    {
+        case format::csv:
+            write_csv(out, results);
+            return;
+        case format::json:
+            write_json(out, results);
+            return;
+        case format::text:
+        default:
+            write_text(out, results);
+            return;
+    }
+}
+
+BC_POP_WARNING()
+
+} // namespace benchmark
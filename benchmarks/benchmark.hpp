@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_BENCHMARKS_BENCHMARK_HPP
+#define LIBBITCOIN_SYSTEM_BENCHMARKS_BENCHMARK_HPP
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <bitcoin/system.hpp>
+
+namespace benchmark {
+
+using namespace bc;
+using namespace bc::system;
+
+/// A body performs one round of its operation and returns a value derived
+/// from the result, which is accumulated to preclude compiler elimination.
+typedef std::function<size_t()> body;
+
+/// Items (e.g. transactions, inputs, keys) and bytes per round of body.
+struct task
+{
+    size_t items;
+    size_t bytes;
+    body function;
+};
+
+/// A setup builds fixtures (untimed) and returns the task, only when run.
+typedef std::function<task()> setup;
+
+struct result
+{
+    typedef std::vector<result> list;
+
+    std::string suite;
+    std::string name;
+
+    /// Items and bytes per round.
+    size_t items;
+    size_t bytes;
+
+    /// Timed rounds and their nanosecond durations.
+    size_t rounds;
+    uint64_t minimum;
+    uint64_t median;
+    uint64_t total;
+
+    /// Accumulation of body results (stable across runs of one build).
+    size_t check;
+};
+
+enum class format
+{
+    text,
+    csv,
+    json
+};
+
+/// Collects and runs benchmarks, each as a warmup round and timed rounds.
+class runner
+{
+public:
+    /// Benchmarks are run if "suite/name" contains filter (empty for all).
+    runner(const std::string& filter, size_t rounds, size_t warmup) NOEXCEPT;
+
+    /// Add a benchmark, run in order of addition.
+    void add(const std::string& suite, const std::string& name,
+        setup&& factory) NOEXCEPT;
+
+    /// Run all matching benchmarks, reporting progress to log.
+    result::list run(std::ostream& log) const NOEXCEPT;
+
+private:
+    struct entry
+    {
+        std::string suite;
+        std::string name;
+        setup factory;
+    };
+
+    result measure(const entry& benchmark) const NOEXCEPT;
+
+    const std::string filter_;
+    const size_t rounds_;
+    const size_t warmup_;
+    std::vector<entry> entries_;
+};
+
+/// Write results with build and machine properties, for regression tracking.
+void write(std::ostream& out, const result::list& results,
+    format type) NOEXCEPT;
+
+/// Suites.
+void add_chain(runner& benchmarks) NOEXCEPT;
+void add_script(runner& benchmarks) NOEXCEPT;
+void add_wallet(runner& benchmarks) NOEXCEPT;
+void add_conversion(runner& benchmarks) NOEXCEPT;
+
+} // namespace benchmark
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "benchmark.hpp"
+#include "fixtures.hpp"
+
+#include <memory>
+#include <utility>
+#include <bitcoin/system.hpp>
+
+namespace benchmark {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr auto spends = 2'000_size;
+constexpr auto transactions = add1(spends);
+
+static std::shared_ptr<const chain::block> block_2000() NOEXCEPT
+{
+    return std::make_shared<const chain::block>(synthetic_block(spends, 2, 2));
+}
+
+// Block and transaction serialization, block check and merkle roots.
+void add_chain(runner& benchmarks) NOEXCEPT
+{
+    benchmarks.add("chain", "deserialize_genesis_block", []() NOEXCEPT
+    {
+        const auto data = std::make_shared<const data_chunk>(
+            genesis_block().to_data(true));
+
+        return task{ one, data->size(), [=]() NOEXCEPT
+        {
+            const chain::block instance{ *data, true };
+            return instance.transactions_ptr()->size();
+        } };
+    });
+
+    benchmarks.add("chain", "deserialize_mainnet_transaction", []() NOEXCEPT
+    {
+        const auto& data = mainnet_transaction();
+        return task{ one, data.size(), [&]() NOEXCEPT
+        {
+            const chain::transaction instance{ data, true };
+            return instance.inputs_ptr()->size();
+        } };
+    });
+
+    benchmarks.add("chain", "deserialize_block_2000", []() NOEXCEPT
+    {
+        const auto data = std::make_shared<const data_chunk>(
+            block_2000()->to_data(true));
+
+        return task{ transactions, data->size(), [=]() NOEXCEPT
+        {
+            const chain::block instance{ *data, true };
+            return instance.transactions_ptr()->size();
+        } };
+    });
+
+    benchmarks.add("chain", "serialize_block_2000", []() NOEXCEPT
+    {
+        const auto block = block_2000();
+        return task{ transactions, block->serialized_size(true), [=]() NOEXCEPT
+        {
+            return block->to_data(true).size();
+        } };
+    });
+
+    benchmarks.add("chain", "check_block_2000", []() NOEXCEPT
+    {
+        const auto block = block_2000();
+        return task{ transactions, zero, [=]() NOEXCEPT
+        {
+            return to_int<size_t>(!block->check());
+        } };
+    });
+
+    benchmarks.add("chain", "txids_block_2000", []() NOEXCEPT
+    {
+        const auto block = block_2000();
+        return task{ transactions, zero, [=]() NOEXCEPT
+        {
+            return block->transaction_hashes(false).size();
+        } };
+    });
+
+    benchmarks.add("chain", "merkle_root_2000", []() NOEXCEPT
+    {
+        const auto txids = std::make_shared<const hashes>(
+            block_2000()->transaction_hashes(false));
+
+        return task{ transactions, transactions * hash_size, [=]() NOEXCEPT
+        {
+            auto copy = *txids;
+            return to_int<size_t>(
+                is_zero(sha256::merkle_root(std::move(copy)).front()));
+        } };
+    });
+}
+
+BC_POP_WARNING()
+
+} // namespace benchmark
@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "benchmark.hpp"
+#include "fixtures.hpp"
+
+#include <memory>
+#include <string>
+#include <bitcoin/system.hpp>
+
+namespace benchmark {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr auto count = 1'000_size;
+constexpr auto checked = 25_size;
+constexpr auto large = 1'024_size * 1'024_size;
+constexpr auto spends = 200_size;
+
+static std::shared_ptr<const data_stack> payloads() NOEXCEPT
+{
+    auto out = std::make_shared<data_stack>();
+    for (size_t index = 0; index < count; ++index)
+        out->push_back(random_data(checked, index));
+
+    return out;
+}
+
+static std::shared_ptr<const std::string> block_json() NOEXCEPT
+{
+    return std::make_shared<const std::string>(boost::json::serialize(
+        boost::json::value_from(synthetic_block(spends, 2, 2))));
+}
+
+// Radix (base16/base58/bech32) and JSON conversions.
+void add_conversion(runner& benchmarks) NOEXCEPT
+{
+    benchmarks.add("conversion", "base58_encode_25x1000", []() NOEXCEPT
+    {
+        const auto data = payloads();
+        return task{ count, count * checked, [=]() NOEXCEPT
+        {
+            size_t check{};
+            for (const auto& payload: *data)
+                check += encode_base58(payload).size();
+
+            return check;
+        } };
+    });
+
+    benchmarks.add("conversion", "base58_decode_25x1000", []() NOEXCEPT
+    {
+        const auto data = payloads();
+        const auto text = std::make_shared<string_list>();
+        for (const auto& payload: *data)
+            text->push_back(encode_base58(payload));
+
+        return task{ count, count * checked, [=]() NOEXCEPT
+        {
+            size_t check{};
+            data_chunk out{};
+            for (const auto& encoded: *text)
+                check += to_int<size_t>(decode_base58(out, encoded));
+
+            return check;
+        } };
+    });
+
+    benchmarks.add("conversion", "bech32_encode_25x1000", []() NOEXCEPT
+    {
+        const auto data = payloads();
+        return task{ count, count * checked, [=]() NOEXCEPT
+        {
+            size_t check{};
+            for (const auto& payload: *data)
+                check += encode_base32(payload).size();
+
+            return check;
+        } };
+    });
+
+    benchmarks.add("conversion", "bech32_decode_25x1000", []() NOEXCEPT
+    {
+        const auto data = payloads();
+        const auto text = std::make_shared<string_list>();
+        for (const auto& payload: *data)
+            text->push_back(encode_base32(payload));
+
+        return task{ count, count * checked, [=]() NOEXCEPT
+        {
+            size_t check{};
+            data_chunk out{};
+            for (const auto& encoded: *text)
+                check += to_int<size_t>(decode_base32(out, encoded));
+
+            return check;
+        } };
+    });
+
+    benchmarks.add("conversion", "base16_encode_1mib", []() NOEXCEPT
+    {
+        const auto data = std::make_shared<const data_chunk>(
+            random_data(large, 42));
+
+        return task{ one, large, [=]() NOEXCEPT
+        {
+            return encode_base16(*data).size();
+        } };
+    });
+
+    benchmarks.add("conversion", "base16_decode_1mib", []() NOEXCEPT
+    {
+        const auto text = std::make_shared<const std::string>(
+            encode_base16(random_data(large, 42)));
+
+        return task{ one, large, [=]() NOEXCEPT
+        {
+            data_chunk out{};
+            return to_int<size_t>(decode_base16(out, *text));
+        } };
+    });
+
+    benchmarks.add("conversion", "json_serialize_block_200", []() NOEXCEPT
+    {
+        const auto block = std::make_shared<const chain::block>(
+            synthetic_block(spends, 2, 2));
+        const auto bytes = block_json()->size();
+
+        return task{ add1(spends), bytes, [=]() NOEXCEPT
+        {
+            return boost::json::serialize(
+                boost::json::value_from(*block)).size();
+        } };
+    });
+
+    benchmarks.add("conversion", "json_parse_block_200", []() NOEXCEPT
+    {
+        const auto text = block_json();
+        return task{ add1(spends), text->size(), [=]() NOEXCEPT
+        {
+            const auto block = boost::json::value_to<chain::block>(
+                boost::json::parse(*text));
+            return block.transactions_ptr()->size();
+        } };
+    });
+}
+
+BC_POP_WARNING()
+
+} // namespace benchmark
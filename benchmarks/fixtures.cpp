@@ -0,0 +1,317 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "fixtures.hpp"
+
+#include <utility>
+#include <bitcoin/system.hpp>
+
+namespace benchmark {
+
+using namespace bc::system::chain;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr uint64_t spend_value = 100'000;
+constexpr uint8_t sighash_all = coverage::hash_all;
+
+data_chunk random_data(size_t size, uint64_t seed) NOEXCEPT
+{
+    // splitmix64, independent of standard library distributions.
+    data_chunk out(size);
+    for (auto& byte: out)
+    {
+        auto value = (seed += 0x9e3779b97f4a7c15_u64);
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9_u64;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111eb_u64;
+        byte = narrow_cast<uint8_t>(value ^ (value >> 31));
+    }
+
+    return out;
+}
+
+static hash_digest random_hash(uint64_t seed) NOEXCEPT
+{
+    hash_digest out{};
+    const auto data = random_data(hash_size, seed);
+    std::copy(data.begin(), data.end(), out.begin());
+    return out;
+}
+
+static short_hash random_short_hash(uint64_t seed) NOEXCEPT
+{
+    short_hash out{};
+    const auto data = random_data(short_hash_size, seed);
+    std::copy(data.begin(), data.end(), out.begin());
+    return out;
+}
+
+const chain::block& genesis_block() NOEXCEPT
+{
+    static const chain::block block
+    {
+        settings(selection::mainnet).genesis_block
+    };
+
+    return block;
+}
+
+const data_chunk& mainnet_transaction() NOEXCEPT
+{
+    static const auto data = base16_chunk(
+        "0100000001f08e44a96bfb5ae63eda1a6620adae37ee37ee4777fb0336e1bbbc"
+        "4de65310fc010000006a473044022050d8368cacf9bf1b8fb1f7cfd9aff63294"
+        "789eb1760139e7ef41f083726dadc4022067796354aba8f2e02363c5e510aa7e"
+        "2830b115472fb31de67d16972867f13945012103e589480b2f746381fca01a9b"
+        "12c517b7a482a203c8b2742985da0ac72cc078f2ffffffff02f0c9c467000000"
+        "001976a914d9d78e26df4e4601cf9b26d09c7b280ee764469f88ac80c4600f00"
+        "0000001976a9141ee32412020a324b93b1a1acfdfff6ab9ca8fac288ac000000"
+        "00");
+
+    return data;
+}
+
+chain::context all_rules() NOEXCEPT
+{
+    return { forks::all_rules, 1'700'000'000, 1'700'000'000, 800'000,
+        4u, 0x1d00ffff };
+}
+
+// synthetic_block
+// ----------------------------------------------------------------------------
+
+static transaction coinbase(size_t height) NOEXCEPT
+{
+    return
+    {
+        1,
+        inputs
+        {
+            {
+                point{},
+                script{ operations{ { to_chunk(to_little_endian(
+                    narrow_cast<uint32_t>(height))), true } } },
+                max_uint32
+            }
+        },
+        outputs
+        {
+            {
+                50'0000'0000_u64,
+                script{ script::to_pay_key_hash_pattern(
+                    random_short_hash(height)) }
+            }
+        },
+        0
+    };
+}
+
+chain::block synthetic_block(size_t spends, size_t inputs,
+    size_t outputs) NOEXCEPT
+{
+    uint64_t seed{ 42 };
+    chain::transactions txs{ coinbase(800'000) };
+    txs.reserve(add1(spends));
+
+    for (size_t tx = 0; tx < spends; ++tx)
+    {
+        chain::inputs ins{};
+        ins.reserve(inputs);
+        for (size_t in = 0; in < inputs; ++in)
+        {
+            ins.emplace_back(
+                point{ random_hash(++seed), narrow_cast<uint32_t>(in) },
+                script{ operations
+                {
+                    { random_data(71, ++seed), true },
+                    { random_data(33, ++seed), true }
+                } },
+                max_uint32);
+        }
+
+        chain::outputs outs{};
+        outs.reserve(outputs);
+        for (size_t out = 0; out < outputs; ++out)
+            outs.emplace_back(spend_value, script{
+                script::to_pay_key_hash_pattern(random_short_hash(++seed)) });
+
+        txs.emplace_back(1, std::move(ins), std::move(outs), 0);
+    }
+
+    // Merkle root is computed from the assembled transactions.
+    const chain::block draft{ chain::header{}, txs };
+    const auto root = sha256::merkle_root(draft.transaction_hashes(false));
+    const chain::block block
+    {
+        chain::header{ 4, random_hash(++seed), root, 1'700'000'000,
+            0x1d00ffff, 0 },
+        std::move(txs)
+    };
+
+    // Populate prevouts of spends (required for block filters).
+    auto index = one;
+    for (const auto& tx: *block.transactions_ptr())
+    {
+        if (tx->is_coinbase())
+            continue;
+
+        for (const auto& in: *tx->inputs_ptr())
+            in->prevout = to_shared<output>(spend_value, script{
+                script::to_pay_key_hash_pattern(random_short_hash(++index)) });
+    }
+
+    return block;
+}
+
+// signed_spend
+// ----------------------------------------------------------------------------
+
+static const ec_secret& secret() NOEXCEPT
+{
+    static const auto key = sha256_hash(to_chunk(std::string{ "benchmark" }));
+    return key;
+}
+
+static const data_chunk& public_key() NOEXCEPT
+{
+    static const auto key = []() NOEXCEPT
+    {
+        ec_compressed point{};
+        secret_to_public(point, secret());
+        return to_chunk(point);
+    }();
+
+    return key;
+}
+
+static script multisig() NOEXCEPT
+{
+    return { script::to_pay_multisig_pattern(1, data_stack{ public_key() }) };
+}
+
+static script prevout_script(spend type) NOEXCEPT
+{
+    switch (type)
+    {
+        case spend::p2sh_multisig:
+            return { script::to_pay_script_hash_pattern(
+                bitcoin_short_hash(multisig().to_data(false))) };
+        case spend::p2wpkh:
+            return { script::to_pay_witness_key_hash_pattern(
+                bitcoin_short_hash(public_key())) };
+        case spend::p2wsh_multisig:
+            return { script::to_pay_witness_script_hash_pattern(
+                sha256_hash(multisig().to_data(false))) };
+        case spend::p2pkh:
+        default:
+            return { script::to_pay_key_hash_pattern(
+                bitcoin_short_hash(public_key())) };
+    }
+}
+
+// The script code committed to by the signature (bip143 for witness).
+static script signing_script(spend type) NOEXCEPT
+{
+    switch (type)
+    {
+        case spend::p2sh_multisig:
+        case spend::p2wsh_multisig:
+            return multisig();
+        case spend::p2wpkh:
+        case spend::p2pkh:
+        default:
+            return { script::to_pay_key_hash_pattern(
+                bitcoin_short_hash(public_key())) };
+    }
+}
+
+chain::transaction signed_spend(spend type, size_t inputs) NOEXCEPT
+{
+    const auto witness = (type == spend::p2wpkh ||
+        type == spend::p2wsh_multisig);
+    const auto version = witness ? script_version::zero :
+        script_version::unversioned;
+
+    chain::inputs unsigned_inputs{};
+    unsigned_inputs.reserve(inputs);
+    for (size_t in = 0; in < inputs; ++in)
+        unsigned_inputs.emplace_back(point{ random_hash(in),
+            narrow_cast<uint32_t>(in) }, script{}, max_uint32);
+
+    const chain::outputs outputs
+    {
+        { sub1(spend_value * inputs), prevout_script(spend::p2pkh) }
+    };
+
+    // Signature hashes do not commit to input scripts or witnesses.
+    const chain::transaction draft{ 1, unsigned_inputs, outputs, 0 };
+    const auto sub = signing_script(type);
+    const auto redeem = multisig().to_data(false);
+
+    chain::inputs signed_inputs{};
+    signed_inputs.reserve(inputs);
+    for (size_t in = 0; in < inputs; ++in)
+    {
+        endorsement signature{};
+        draft.create_endorsement(signature, secret(), sub,
+            narrow_cast<uint32_t>(in), spend_value, sighash_all, version,
+            witness);
+
+        const auto& point = unsigned_inputs.at(in).point();
+        switch (type)
+        {
+            case spend::p2sh_multisig:
+                signed_inputs.emplace_back(point, script{ operations
+                {
+                    { opcode::push_size_0 },
+                    { signature, true },
+                    { redeem, true }
+                } }, max_uint32);
+                break;
+            case spend::p2wpkh:
+                signed_inputs.emplace_back(point, script{},
+                    chain::witness{ data_stack{ signature, public_key() } },
+                    max_uint32);
+                break;
+            case spend::p2wsh_multisig:
+                signed_inputs.emplace_back(point, script{},
+                    chain::witness{ data_stack{ {}, signature, redeem } },
+                    max_uint32);
+                break;
+            case spend::p2pkh:
+            default:
+                signed_inputs.emplace_back(point, script{ operations
+                {
+                    { signature, true },
+                    { public_key(), true }
+                } }, max_uint32);
+                break;
+        }
+    }
+
+    const chain::transaction tx{ 1, std::move(signed_inputs), outputs, 0 };
+    const auto prevout = to_shared<output>(spend_value, prevout_script(type));
+    for (const auto& in: *tx.inputs_ptr())
+        in->prevout = prevout;
+
+    return tx;
+}
+
+BC_POP_WARNING()
+
+} // namespace benchmark
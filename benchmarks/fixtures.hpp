@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_BENCHMARKS_FIXTURES_HPP
+#define LIBBITCOIN_SYSTEM_BENCHMARKS_FIXTURES_HPP
+
+#include "benchmark.hpp"
+
+namespace benchmark {
+
+/// Fixtures are deterministic, so results are comparable across builds.
+/// ---------------------------------------------------------------------------
+
+/// Deterministic pseudo-random data.
+data_chunk random_data(size_t size, uint64_t seed) NOEXCEPT;
+
+/// Mainnet genesis block.
+const chain::block& genesis_block() NOEXCEPT;
+
+/// Mainnet transaction (bf7c3f5a...b9b8e270), one p2pkh input.
+const data_chunk& mainnet_transaction() NOEXCEPT;
+
+/// Context with all rules active (for check and connect).
+chain::context all_rules() NOEXCEPT;
+
+/// Coinbase and spends transactions of inputs to outputs (p2pkh scripts).
+/// Passes block check, input prevouts are populated (for filters).
+chain::block synthetic_block(size_t spends, size_t inputs,
+    size_t outputs) NOEXCEPT;
+
+/// Output types of signed spends.
+enum class spend
+{
+    p2pkh,
+    p2sh_multisig,
+    p2wpkh,
+    p2wsh_multisig
+};
+
+/// Transaction of inputs each signed spend of type, prevouts populated.
+chain::transaction signed_spend(spend type, size_t inputs) NOEXCEPT;
+
+} // namespace benchmark
+
+#endif
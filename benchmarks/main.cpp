@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <bitcoin/system.hpp>
+#include "benchmark.hpp"
+
+BC_USE_LIBBITCOIN_MAIN
+
+static void usage() NOEXCEPT
+{
+    bc::system::cerr <<
+        "usage: libbitcoin-system-benchmarks [options]\n"
+        "  --format text|csv|json  output format (default text)\n"
+        "  --filter <text>         run only suite/name containing text\n"
+        "  --rounds <count>        timed rounds per benchmark (default 20)\n"
+        "  --warmup <count>        untimed rounds per benchmark (default 2)\n"
+        "  --output <file>         write results to file (default stdout)\n"
+        << std::endl;
+}
+
+// Benchmarks of chain, script, wallet and conversion hot paths, with
+// deterministic fixtures and machine-readable output for regression tracking.
+int bc::system::main(int argc, char* argv[])
+{
+    using namespace bc::system;
+    using namespace benchmark;
+
+    set_utf8_stdio();
+
+    std::string filter{};
+    std::string output{};
+    size_t rounds{ 20 };
+    size_t warmup{ 2 };
+    auto type = format::text;
+
+    for (auto arg = 1; arg < argc; ++arg)
+    {
+        const std::string option{ argv[arg] };
+        if (option == "--help")
+        {
+            usage();
+            return EXIT_SUCCESS;
+        }
+
+        if (add1(arg) == argc)
+        {
+            usage();
+            return EXIT_FAILURE;
+        }
+
+        const std::string value{ argv[++arg] };
+        if (option == "--format" && value == "text")
+            type = format::text;
+        else if (option == "--format" && value == "csv")
+            type = format::csv;
+        else if (option == "--format" && value == "json")
+            type = format::json;
+        else if (option == "--filter")
+            filter = value;
+        else if (option == "--output")
+            output = value;
+        else if (option == "--rounds" && deserialize(rounds, value))
+            continue;
+        else if (option == "--warmup" && deserialize(warmup, value))
+            continue;
+        else
+        {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    runner benchmarks{ filter, rounds, warmup };
+    add_chain(benchmarks);
+    add_script(benchmarks);
+    add_wallet(benchmarks);
+    add_conversion(benchmarks);
+
+    const auto results = benchmarks.run(system::cerr);
+    if (output.empty())
+    {
+        benchmark::write(system::cout, results, type);
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream file{ output };
+    benchmark::write(file, results, type);
+    return file.good() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
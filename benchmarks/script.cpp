@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "benchmark.hpp"
+#include "fixtures.hpp"
+
+#include <memory>
+#include <string>
+#include <bitcoin/system.hpp>
+
+namespace benchmark {
+
+using namespace bc::system::chain;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr auto sighash_inputs = 100_size;
+constexpr auto connect_inputs = 10_size;
+constexpr uint8_t sighash_all = coverage::hash_all;
+
+static void add_sighash(runner& benchmarks, const std::string& name,
+    script_version version, bool bip143) NOEXCEPT
+{
+    benchmarks.add("script", name, [=]() NOEXCEPT
+    {
+        const auto tx = std::make_shared<const transaction>(
+            signed_spend(spend::p2pkh, sighash_inputs));
+        const auto& prevout = tx->inputs_ptr()->front()->prevout;
+        const auto value = prevout->value();
+        const auto sub = prevout->script();
+
+        return task{ sighash_inputs, zero, [=]() NOEXCEPT
+        {
+            size_t check{};
+            const auto& ins = *tx->inputs_ptr();
+            for (auto in = ins.begin(); in != ins.end(); ++in)
+                check += tx->signature_hash(in, sub, value, sighash_all,
+                    version, bip143).front();
+
+            return check;
+        } };
+    });
+}
+
+static void add_connect(runner& benchmarks, const std::string& name,
+    spend type) NOEXCEPT
+{
+    benchmarks.add("script", name, [=]() NOEXCEPT
+    {
+        const auto tx = std::make_shared<const transaction>(
+            signed_spend(type, connect_inputs));
+        const auto context = all_rules();
+
+        return task{ connect_inputs, zero, [=]() NOEXCEPT
+        {
+            return to_int<size_t>(!tx->connect(context));
+        } };
+    });
+}
+
+// Signature hashing and script validation (connect) per output type.
+// Legacy signature hashes serialize the transaction for each input, bip143
+// hashes are computed per input here (no connect hash cache).
+void add_script(runner& benchmarks) NOEXCEPT
+{
+    add_sighash(benchmarks, "sighash_legacy_100", script_version::unversioned,
+        false);
+    add_sighash(benchmarks, "sighash_bip143_100", script_version::zero, true);
+    add_connect(benchmarks, "connect_p2pkh_10", spend::p2pkh);
+    add_connect(benchmarks, "connect_p2sh_multisig_10", spend::p2sh_multisig);
+    add_connect(benchmarks, "connect_p2wpkh_10", spend::p2wpkh);
+    add_connect(benchmarks, "connect_p2wsh_multisig_10",
+        spend::p2wsh_multisig);
+}
+
+BC_POP_WARNING()
+
+} // namespace benchmark
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "benchmark.hpp"
+#include "fixtures.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <bitcoin/system.hpp>
+
+namespace benchmark {
+
+using namespace bc::system::wallet;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr auto keys = 100_size;
+constexpr auto addresses = 1'000_size;
+constexpr auto spends = 2'000_size;
+
+static std::shared_ptr<const short_hashes> random_hashes() NOEXCEPT
+{
+    auto hashes = std::make_shared<short_hashes>(addresses);
+    for (size_t index = 0; index < addresses; ++index)
+    {
+        const auto data = random_data(short_hash_size, index);
+        std::copy(data.begin(), data.end(), hashes->at(index).begin());
+    }
+
+    return hashes;
+}
+
+// HD derivation, address conversion and compact block filters.
+void add_wallet(runner& benchmarks) NOEXCEPT
+{
+    benchmarks.add("wallet", "hd_derive_private_hardened_100", []() NOEXCEPT
+    {
+        const auto root = std::make_shared<const hd_private>(
+            random_data(64, 42));
+
+        return task{ keys, zero, [=]() NOEXCEPT
+        {
+            size_t check{};
+            for (uint32_t index = 0; index < keys; ++index)
+                check += root->derive_private(
+                    hd_first_hardened_key + index).secret().front();
+
+            return check;
+        } };
+    });
+
+    benchmarks.add("wallet", "hd_derive_public_100", []() NOEXCEPT
+    {
+        const auto root = std::make_shared<const hd_public>(
+            hd_private{ random_data(64, 42) }.to_public());
+
+        return task{ keys, zero, [=]() NOEXCEPT
+        {
+            size_t check{};
+            for (uint32_t index = 0; index < keys; ++index)
+                check += root->derive_public(index).point().back();
+
+            return check;
+        } };
+    });
+
+    benchmarks.add("wallet", "payment_address_encode_1000", []() NOEXCEPT
+    {
+        const auto hashes = random_hashes();
+        return task{ addresses, zero, [=]() NOEXCEPT
+        {
+            string_list out{};
+            payment_address::encode(out, *hashes);
+            return out.back().size();
+        } };
+    });
+
+    benchmarks.add("wallet", "payment_address_decode_1000", []() NOEXCEPT
+    {
+        const auto encoded = std::make_shared<string_list>();
+        payment_address::encode(*encoded, *random_hashes());
+
+        return task{ addresses, zero, [=]() NOEXCEPT
+        {
+            payment_address::list out{};
+            payment_address::decode(out, *encoded);
+            return to_int<size_t>(out.back());
+        } };
+    });
+
+    benchmarks.add("wallet", "witness_address_encode_1000", []() NOEXCEPT
+    {
+        const auto hashes = random_hashes();
+        return task{ addresses, zero, [=]() NOEXCEPT
+        {
+            string_list out{};
+            witness_address::encode(out, *hashes);
+            return out.back().size();
+        } };
+    });
+
+    benchmarks.add("wallet", "witness_address_decode_1000", []() NOEXCEPT
+    {
+        const auto encoded = std::make_shared<string_list>();
+        witness_address::encode(*encoded, *random_hashes());
+
+        return task{ addresses, zero, [=]() NOEXCEPT
+        {
+            witness_address::list out{};
+            witness_address::decode(out, *encoded);
+            return to_int<size_t>(out.back());
+        } };
+    });
+
+    benchmarks.add("wallet", "neutrino_filter_block_2000", []() NOEXCEPT
+    {
+        const auto block = std::make_shared<const chain::block>(
+            synthetic_block(spends, 2, 2));
+
+        return task{ add1(spends), zero, [=]() NOEXCEPT
+        {
+            data_chunk filter{};
+            neutrino::compute_filter(*block, filter);
+            return filter.size();
+        } };
+    });
+}
+
+BC_POP_WARNING()
+
+} // namespace benchmark
@@ -33,15 +33,19 @@
 #include <bitcoin/system/chain/checkpoint.hpp>
 #include <bitcoin/system/chain/compact.hpp>
 #include <bitcoin/system/chain/context.hpp>
+#include <bitcoin/system/chain/footprint.hpp>
 #include <bitcoin/system/chain/header.hpp>
 #include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/json_reader.hpp>
 #include <bitcoin/system/chain/operation.hpp>
 #include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/packed_transaction.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/prevout.hpp>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/chain/stripper.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/transaction_builder.hpp>
 #include <bitcoin/system/chain/witness.hpp>
 #include <bitcoin/system/chain/enums/coverage.hpp>
 #include <bitcoin/system/chain/enums/forks.hpp>
@@ -72,12 +76,15 @@
 #include <bitcoin/system/config/script.hpp>
 #include <bitcoin/system/config/transaction.hpp>
 #include <bitcoin/system/crypto/aes256.hpp>
+#include <bitcoin/system/crypto/chacha20.hpp>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/crypto/der_parser.hpp>
 #include <bitcoin/system/crypto/golomb_coding.hpp>
 #include <bitcoin/system/crypto/pseudo_random.hpp>
 #include <bitcoin/system/crypto/ring_signature.hpp>
 #include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/crypto/secure_random.hpp>
+#include <bitcoin/system/crypto/signature_cache.hpp>
 #include <bitcoin/system/data/array_cast.hpp>
 #include <bitcoin/system/data/byte_cast.hpp>
 #include <bitcoin/system/data/collection.hpp>
@@ -117,6 +124,7 @@
 #include <bitcoin/system/hash/functions.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/hash/hmac.hpp>
+#include <bitcoin/system/hash/merkle.hpp>
 #include <bitcoin/system/hash/pbkd.hpp>
 #include <bitcoin/system/hash/scrypt.hpp>
 #include <bitcoin/system/hash/siphash.hpp>
@@ -143,17 +151,20 @@
 #include <bitcoin/system/intrinsics/xcpu/functional_512.hpp>
 #include <bitcoin/system/intrinsics/xcpu/sha.hpp>
 #include <bitcoin/system/intrinsics/xcpu/xcpu.hpp>
+#include <bitcoin/system/machine/arena.hpp>
 #include <bitcoin/system/machine/interpreter.hpp>
 #include <bitcoin/system/machine/machine.hpp>
 #include <bitcoin/system/machine/number.hpp>
 #include <bitcoin/system/machine/program.hpp>
 #include <bitcoin/system/machine/stack.hpp>
+#include <bitcoin/system/machine/verification_cache.hpp>
 #include <bitcoin/system/math/addition.hpp>
 #include <bitcoin/system/math/bits.hpp>
 #include <bitcoin/system/math/bytes.hpp>
 #include <bitcoin/system/math/byteswap.hpp>
 #include <bitcoin/system/math/cast.hpp>
 #include <bitcoin/system/math/division.hpp>
+#include <bitcoin/system/math/fixed_uint256.hpp>
 #include <bitcoin/system/math/functional.hpp>
 #include <bitcoin/system/math/limits.hpp>
 #include <bitcoin/system/math/logarithm.hpp>
@@ -173,6 +184,7 @@
 #include <bitcoin/system/radix/radix.hpp>
 #include <bitcoin/system/serial/deserialize.hpp>
 #include <bitcoin/system/serial/props.hpp>
+#include <bitcoin/system/serial/props_writer.hpp>
 #include <bitcoin/system/serial/serial.hpp>
 #include <bitcoin/system/serial/serialize.hpp>
 #include <bitcoin/system/stream/binary.hpp>
@@ -198,6 +210,7 @@
 #include <bitcoin/system/stream/streamers/byte_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256x2_writer.hpp>
+#include <bitcoin/system/stream/streamers/span_reader.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitflipper.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitreader.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitwriter.hpp>
@@ -223,6 +236,7 @@
 #include <bitcoin/system/wallet/message.hpp>
 #include <bitcoin/system/wallet/neutrino_filter.hpp>
 #include <bitcoin/system/wallet/point_value.hpp>
+#include <bitcoin/system/wallet/points_index.hpp>
 #include <bitcoin/system/wallet/points_value.hpp>
 #include <bitcoin/system/wallet/wallet.hpp>
 #include <bitcoin/system/wallet/addresses/bitcoin_uri.hpp>
@@ -231,11 +245,13 @@
 #include <bitcoin/system/wallet/addresses/qr_code.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_address.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_receiver.hpp>
+#include <bitcoin/system/wallet/addresses/stealth_scanner.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_sender.hpp>
 #include <bitcoin/system/wallet/addresses/tiff.hpp>
 #include <bitcoin/system/wallet/addresses/uri.hpp>
 #include <bitcoin/system/wallet/addresses/uri_reader.hpp>
 #include <bitcoin/system/wallet/addresses/witness_address.hpp>
+#include <bitcoin/system/wallet/keys/ec_affine.hpp>
 #include <bitcoin/system/wallet/keys/ec_point.hpp>
 #include <bitcoin/system/wallet/keys/ec_private.hpp>
 #include <bitcoin/system/wallet/keys/ec_public.hpp>
@@ -255,6 +271,7 @@
 #include <bitcoin/system/words/dictionary.hpp>
 #include <bitcoin/system/words/language.hpp>
 #include <bitcoin/system/words/languages.hpp>
+#include <bitcoin/system/words/perfect_hash.hpp>
 #include <bitcoin/system/words/words.hpp>
 #include <bitcoin/system/words/catalogs/electrum.hpp>
 #include <bitcoin/system/words/catalogs/electrum_v1.hpp>
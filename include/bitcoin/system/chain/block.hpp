@@ -29,6 +29,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/serial/props_writer.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -58,6 +59,8 @@ public:
     block(std::istream& stream, bool witness) NOEXCEPT;
     block(reader&& source, bool witness) NOEXCEPT;
     block(reader& source, bool witness) NOEXCEPT;
+    block(span_reader&& source, bool witness) NOEXCEPT;
+    block(span_reader& source, bool witness) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -100,13 +103,22 @@ public:
     code check(const context& ctx) const NOEXCEPT;
     code accept(const context& ctx, size_t subsidy_interval,
         uint64_t initial_subsidy) const NOEXCEPT;
-    code connect(const context& ctx) const NOEXCEPT;
+    code connect(const context& ctx,
+        signature_cache* signatures=nullptr) const NOEXCEPT;
     code confirm(const context& ctx) const NOEXCEPT;
 
     /// Populate previous output metadata internal to the block.
     /// Does not populate forward references (consensus limited).
     void populate() const NOEXCEPT;
 
+    /// Compute tx hashes (and segregated tx witness hashes if witness) across
+    /// all txs concurrently, cached in each tx for merkle root, witness
+    /// commitment and downstream reuse (e.g. compact block reconstruction).
+    /// Existing caches are retained. Caches are not thread safe, so this must
+    /// not be called while the txs are read by other threads (e.g. invoke
+    /// before check() and before the block is shared).
+    void populate_hashes(bool witness) const NOEXCEPT;
+
 protected:
     block(const chain::header::cptr& header,
         const chain::transactions_cptr& txs, bool valid) NOEXCEPT;
@@ -142,7 +154,8 @@ protected:
     bool is_unspent_coinbase_collision() const NOEXCEPT;
 
 private:
-    static block from_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Source>
+    static block from_data(Source& source, bool witness) NOEXCEPT;
 
     // context free
     hash_digest generate_merkle_root(bool witness) const NOEXCEPT;
@@ -156,7 +169,8 @@ private:
     code check_transactions() const NOEXCEPT;
     code check_transactions(const context& ctx) const NOEXCEPT;
     code accept_transactions(const context& ctx) const NOEXCEPT;
-    code connect_transactions(const context& ctx) const NOEXCEPT;
+    code connect_transactions(const context& ctx,
+        signature_cache* signatures) const NOEXCEPT;
     code confirm_transactions(const context& ctx) const NOEXCEPT;
 
     // Block should be stored as shared (adds 16 bytes).
@@ -171,6 +185,8 @@ typedef std::vector<block> blocks;
 DECLARE_JSON_VALUE_CONVERTORS(block);
 DECLARE_JSON_VALUE_CONVERTORS(block::cptr);
 
+BC_API void to_props(props_writer& writer, const block& block) NOEXCEPT;
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
@@ -40,6 +40,9 @@ struct compact
   : public base256e
 {
 public:
+    /// Fixed width (stack) arithmetic type for proof of work and chain work.
+    using span_type = fixed_uint256;
+
     /// A zero value implies an invalid (including zero) parameter.
     /// Non-minimal exponent encoding allowed only for mantissa sign bug.
     static constexpr span_type expand(small_type exponential) NOEXCEPT;
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_FOOTPRINT_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_FOOTPRINT_HPP
+
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/operation.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/packed_transaction.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Approximate resident bytes of an object, including owned heap allocations.
+/// Each shared child is charged its object and a reference count block, as if
+/// not shared with any other owner. Vectors are charged by capacity. Allocator
+/// bookkeeping and lazily-computed hash caches are not included. An input's
+/// prevout is populated metadata, owned by the store, and is not included.
+BC_API size_t footprint(const operation& operation) NOEXCEPT;
+BC_API size_t footprint(const script& script) NOEXCEPT;
+BC_API size_t footprint(const witness& witness) NOEXCEPT;
+BC_API size_t footprint(const point& point) NOEXCEPT;
+BC_API size_t footprint(const input& input) NOEXCEPT;
+BC_API size_t footprint(const output& output) NOEXCEPT;
+BC_API size_t footprint(const transaction& tx) NOEXCEPT;
+BC_API size_t footprint(const header& header) NOEXCEPT;
+BC_API size_t footprint(const block& block) NOEXCEPT;
+BC_API size_t footprint(const packed_transaction& tx) NOEXCEPT;
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
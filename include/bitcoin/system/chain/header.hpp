@@ -26,6 +26,7 @@
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/serial/props_writer.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -69,6 +70,8 @@ public:
     header(std::istream& stream) NOEXCEPT;
     header(reader&& source) NOEXCEPT;
     header(reader& source) NOEXCEPT;
+    header(span_reader&& source) NOEXCEPT;
+    header(span_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -97,7 +100,7 @@ public:
 
     /// Computed properties.
     hash_digest hash() const NOEXCEPT;
-    uint256_t difficulty() const NOEXCEPT;
+    fixed_uint256 difficulty() const NOEXCEPT;
 
     /// Cache (this overrides hash() computation).
     void set_hash(hash_digest&& hash) const NOEXCEPT;
@@ -133,8 +136,9 @@ protected:
     // error::incorrect_proof_of_work
 
 private:
-    static header from_data(reader& source) NOEXCEPT;
-    static uint256_t difficulty(uint32_t bits) NOEXCEPT;
+    template <typename Source>
+    static header from_data(Source& source) NOEXCEPT;
+    static fixed_uint256 difficulty(uint32_t bits) NOEXCEPT;
 
     // Header should be stored as shared (adds 16 bytes).
     // copy: 4 * 32 + 2 * 256 + 1 = 81 bytes (vs. 16 when shared).
@@ -158,6 +162,8 @@ typedef std::shared_ptr<const header_cptrs> headers_cptr;
 DECLARE_JSON_VALUE_CONVERTORS(header);
 DECLARE_JSON_VALUE_CONVERTORS(header::cptr);
 
+BC_API void to_props(props_writer& writer, const header& header) NOEXCEPT;
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
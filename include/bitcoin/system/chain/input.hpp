@@ -30,6 +30,7 @@
 #include <bitcoin/system/chain/witness.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/serial/props_writer.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -72,6 +73,8 @@ public:
     input(std::istream& stream) NOEXCEPT;
     input(reader&& source) NOEXCEPT;
     input(reader& source) NOEXCEPT;
+    input(span_reader&& source) NOEXCEPT;
+    input(span_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -124,7 +127,8 @@ protected:
         bool valid) NOEXCEPT;
 
 private:
-    static input from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static input from_data(Source& source) NOEXCEPT;
     bool extract_sigop_script(chain::script& out,
         const chain::script& prevout_script) const NOEXCEPT;
 
@@ -151,6 +155,8 @@ typedef std::shared_ptr<const input_cptrs> inputs_cptr;
 DECLARE_JSON_VALUE_CONVERTORS(input);
 DECLARE_JSON_VALUE_CONVERTORS(input::cptr);
 
+BC_API void to_props(props_writer& writer, const input& input) NOEXCEPT;
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_JSON_READER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_JSON_READER_HPP
+
+#include <string_view>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Parse json text, in the layout of the json::value_from conversions (and
+/// to_props), directly into chain objects. Inputs, outputs and transactions
+/// are constructed in place as the text is parsed, with no json::value tree
+/// or intermediate element vectors. Members may appear in any order, but all
+/// are required and unknown members are not allowed. String values are
+/// consumed directly from the text unless split or escaped.
+/// False if the text is not valid json, does not match the layout, or
+/// contains an invalid hash, script or witness (out is then unspecified).
+BC_API bool from_json(transaction& out, const std::string_view& text) NOEXCEPT;
+BC_API bool from_json(transactions& out, const std::string_view& text) NOEXCEPT;
+BC_API bool from_json(block& out, const std::string_view& text) NOEXCEPT;
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
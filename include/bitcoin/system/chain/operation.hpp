@@ -369,6 +369,8 @@ public:
     operation(std::istream& stream) NOEXCEPT;
     operation(reader&& source) NOEXCEPT;
     operation(reader& source) NOEXCEPT;
+    operation(span_reader&& source) NOEXCEPT;
+    operation(span_reader& source) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     // TODO: a byte-deserialized operation cannot be invalid unless empty.
@@ -435,7 +437,8 @@ private:
     // So script may call count_op.
     friend class script;
 
-    static operation from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static operation from_data(Source& source) NOEXCEPT;
     static operation from_push_data(const chunk_cptr& data,
         bool minimal) NOEXCEPT;
 
@@ -445,7 +448,12 @@ private:
     static chunk_cptr no_data_ptr() NOEXCEPT;
     static chunk_cptr any_data_ptr() NOEXCEPT;
     static bool count_op(reader& source) NOEXCEPT;
-    static uint32_t read_data_size(opcode code, reader& source) NOEXCEPT;
+    static bool count_op(span_reader& source) NOEXCEPT;
+
+    template <typename Source>
+    static bool do_count_op(Source& source) NOEXCEPT;
+    template <typename Source>
+    static uint32_t read_data_size(opcode code, Source& source) NOEXCEPT;
 
     static inline opcode opcode_from_data(const data_chunk& push_data,
         bool minimal) NOEXCEPT
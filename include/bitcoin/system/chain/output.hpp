@@ -24,6 +24,7 @@
 #include <vector>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/serial/props_writer.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -55,6 +56,8 @@ public:
     output(std::istream& stream) NOEXCEPT;
     output(reader&& source) NOEXCEPT;
     output(reader& source) NOEXCEPT;
+    output(span_reader&& source) NOEXCEPT;
+    output(span_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -93,7 +96,8 @@ protected:
         bool valid) NOEXCEPT;
 
 private:
-    static output from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static output from_data(Source& source) NOEXCEPT;
 
     // Output should be stored as shared (adds 16 bytes).
     // copy: 3 * 64 + 1 = 25 bytes (vs. 16 when shared).
@@ -110,6 +114,8 @@ typedef std::shared_ptr<const output_cptrs> outputs_cptr;
 DECLARE_JSON_VALUE_CONVERTORS(output);
 DECLARE_JSON_VALUE_CONVERTORS(output::cptr);
 
+BC_API void to_props(props_writer& writer, const output& output) NOEXCEPT;
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
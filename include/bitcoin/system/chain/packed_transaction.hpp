@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_PACKED_TRANSACTION_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_PACKED_TRANSACTION_HPP
+
+#include <memory>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Immutable transaction held in a single allocation (e.g. for a mempool).
+/// The buffer holds a table of element offsets followed by the serialization
+/// (with witnesses where segregated). Scalars are read in place and elements
+/// are deserialized on access, trading access cost for footprint, as there
+/// are no per-element allocations or reference counts.
+class BC_API packed_transaction
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(packed_transaction);
+
+    typedef std::shared_ptr<const packed_transaction> cptr;
+
+    /// Constructors.
+    /// -----------------------------------------------------------------------
+
+    /// Default packed transaction is an invalid object.
+    packed_transaction() NOEXCEPT;
+
+    packed_transaction(const transaction& tx) NOEXCEPT;
+    packed_transaction(const data_slice& data) NOEXCEPT;
+
+    /// Operators.
+    /// -----------------------------------------------------------------------
+
+    bool operator==(const packed_transaction& other) const NOEXCEPT;
+    bool operator!=(const packed_transaction& other) const NOEXCEPT;
+
+    /// Serialization.
+    /// -----------------------------------------------------------------------
+
+    data_chunk to_data(bool witness) const NOEXCEPT;
+    transaction to_transaction() const NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    /// Native properties.
+    bool is_valid() const NOEXCEPT;
+    bool is_segregated() const NOEXCEPT;
+    uint32_t version() const NOEXCEPT;
+    uint32_t locktime() const NOEXCEPT;
+    size_t input_count() const NOEXCEPT;
+    size_t output_count() const NOEXCEPT;
+
+    /// Element properties (indexes are guarded by assertion).
+    chain::point point(size_t index) const NOEXCEPT;
+    uint32_t sequence(size_t index) const NOEXCEPT;
+    uint64_t value(size_t index) const NOEXCEPT;
+
+    /// Elements are deserialized on each call.
+    chain::input input(size_t index) const NOEXCEPT;
+    chain::output output(size_t index) const NOEXCEPT;
+
+    /// Computed properties.
+    size_t serialized_size(bool witness) const NOEXCEPT;
+    hash_digest hash(bool witness) const NOEXCEPT;
+    bool is_coinbase() const NOEXCEPT;
+
+    /// Size of the single buffer allocation (offsets and serialization).
+    size_t buffer_size() const NOEXCEPT;
+
+private:
+    size_t slots() const NOEXCEPT;
+    size_t offset(size_t slot) const NOEXCEPT;
+    size_t input_offset(size_t index) const NOEXCEPT;
+    size_t output_offset(size_t index) const NOEXCEPT;
+    size_t witness_offset(size_t index) const NOEXCEPT;
+    size_t locktime_offset() const NOEXCEPT;
+    data_slice wire() const NOEXCEPT;
+    data_slice slice(size_t begin, size_t end) const NOEXCEPT;
+    size_t prefix_size() const NOEXCEPT;
+
+    // [offsets (little-endian uint32)][serialization]
+    // Offsets are relative to the serialization: inputs[0..n], outputs[0..n],
+    // and if segregated witnesses[0..n] (each with a trailing end offset).
+    data_chunk buffer_;
+    uint32_t inputs_;
+    uint32_t outputs_;
+    bool segregated_;
+    bool valid_;
+};
+
+typedef std::vector<packed_transaction> packed_transactions;
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -25,6 +25,7 @@
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/serial/props_writer.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -61,6 +62,8 @@ public:
     point(std::istream& stream) NOEXCEPT;
     point(reader&& source) NOEXCEPT;
     point(reader& source) NOEXCEPT;
+    point(span_reader&& source) NOEXCEPT;
+    point(span_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -91,7 +94,8 @@ protected:
     point(const hash_digest& hash, uint32_t index, bool valid) NOEXCEPT;
 
 private:
-    static point from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static point from_data(Source& source) NOEXCEPT;
 
     // The index is consensus-serialized as a fixed 4 bytes, however it is
     // effectively bound to 2^17 by the block byte size limit.
@@ -111,6 +115,8 @@ typedef std::vector<point> points;
 DECLARE_JSON_VALUE_CONVERTORS(point);
 DECLARE_JSON_VALUE_CONVERTORS(point::cptr);
 
+BC_API void to_props(props_writer& writer, const point& point) NOEXCEPT;
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
@@ -35,6 +35,7 @@
 #include <bitcoin/system/endian/endian.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/serial/props_writer.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -447,6 +448,8 @@ public:
     script(std::istream& stream, bool prefix) NOEXCEPT;
     script(reader&& source, bool prefix) NOEXCEPT;
     script(reader& source, bool prefix) NOEXCEPT;
+    script(span_reader&& source, bool prefix) NOEXCEPT;
+    script(span_reader& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     script(const std::string& mnemonic) NOEXCEPT;
@@ -509,8 +512,10 @@ protected:
 private:
     // TODO: move to config serialization wrapper.
     static script from_string(const std::string& mnemonic) NOEXCEPT;
-    static script from_data(reader& source, bool prefix) NOEXCEPT;
-    static size_t op_count(reader& source) NOEXCEPT;
+    template <typename Source>
+    static script from_data(Source& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    static size_t op_count(Source& source) NOEXCEPT;
 
     // Script should be stored as shared.
     operations ops_;
@@ -532,6 +537,8 @@ typedef std::vector<script> scripts;
 DECLARE_JSON_VALUE_CONVERTORS(script);
 DECLARE_JSON_VALUE_CONVERTORS(script::cptr);
 
+BC_API void to_props(props_writer& writer, const script& script) NOEXCEPT;
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
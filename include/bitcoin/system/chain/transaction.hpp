@@ -26,9 +26,12 @@
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/crypto/signature_cache.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/machine/verification_cache.hpp>
+#include <bitcoin/system/serial/props_writer.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -67,6 +70,8 @@ public:
     transaction(std::istream& stream, bool witness) NOEXCEPT;
     transaction(reader&& source, bool witness) NOEXCEPT;
     transaction(reader& source, bool witness) NOEXCEPT;
+    transaction(span_reader&& source, bool witness) NOEXCEPT;
+    transaction(span_reader& source, bool witness) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -108,6 +113,11 @@ public:
     /// Cache (these override hash(bool) computation).
     void set_hash(hash_digest&& hash) const NOEXCEPT;
     void set_witness_hash(hash_digest&& hash) const NOEXCEPT;
+    bool is_hashed(bool witness) const NOEXCEPT;
+
+    /// Cache (these override bip143 signature hash components computation).
+    void set_signature_hashes(hash_digest&& outputs, hash_digest&& points,
+        hash_digest&& sequences) const NOEXCEPT;
 
     /// Methods.
     /// -----------------------------------------------------------------------
@@ -149,7 +159,10 @@ public:
     code check() const NOEXCEPT;
     code check(const context& ctx) const NOEXCEPT;
     code accept(const context& ctx) const NOEXCEPT;
-    code connect(const context& ctx) const NOEXCEPT;
+    code connect(const context& ctx,
+        signature_cache* signatures=nullptr) const NOEXCEPT;
+    code connect(const context& ctx, machine::verification_cache& cache,
+        signature_cache* signatures=nullptr) const NOEXCEPT;
     code confirm(const context& ctx) const NOEXCEPT;
 
 protected:
@@ -214,7 +227,8 @@ protected:
     bool is_confirmed_double_spend(size_t height) const NOEXCEPT;
 
 private:
-    static transaction from_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Source>
+    static transaction from_data(Source& source, bool witness) NOEXCEPT;
     static bool segregated(const chain::inputs& inputs) NOEXCEPT;
     static bool segregated(const chain::input_cptrs& inputs) NOEXCEPT;
     ////static size_t maximum_size(bool coinbase) NOEXCEPT;
@@ -270,6 +284,8 @@ typedef std::shared_ptr<const transaction_cptrs> transactions_cptr;
 DECLARE_JSON_VALUE_CONVERTORS(transaction);
 DECLARE_JSON_VALUE_CONVERTORS(transaction::cptr);
 
+BC_API void to_props(props_writer& writer, const transaction& tx) NOEXCEPT;
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
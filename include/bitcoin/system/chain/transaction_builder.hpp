@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_BUILDER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_BUILDER_HPP
+
+#include <vector>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Mutable transaction for repeated edit and hash (e.g. fee bumping).
+/// Inputs and outputs are shared with the source transaction and replaced
+/// (never mutated) on edit. The serialization of each input, output and
+/// witness is cached, as is the hash state at the end of each segment, so
+/// that hashing resumes at the first changed segment. The bip143 points,
+/// sequences and outputs hashes are resumed in the same manner.
+class BC_API transaction_builder
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(transaction_builder);
+
+    /// Constructors.
+    /// -----------------------------------------------------------------------
+
+    transaction_builder(uint32_t version, uint32_t locktime) NOEXCEPT;
+    transaction_builder(const transaction& tx) NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    uint32_t version() const NOEXCEPT;
+    uint32_t locktime() const NOEXCEPT;
+    const input_cptrs& inputs() const NOEXCEPT;
+    const output_cptrs& outputs() const NOEXCEPT;
+    bool is_segregated() const NOEXCEPT;
+
+    /// Edits (indexes are guarded by assertion).
+    /// -----------------------------------------------------------------------
+
+    void set_version(uint32_t version) NOEXCEPT;
+    void set_locktime(uint32_t locktime) NOEXCEPT;
+
+    void set_input(size_t index, const input::cptr& input) NOEXCEPT;
+    void set_sequence(size_t index, uint32_t sequence) NOEXCEPT;
+    void push_input(const input::cptr& input) NOEXCEPT;
+    void erase_input(size_t index) NOEXCEPT;
+
+    void set_output(size_t index, const output::cptr& output) NOEXCEPT;
+    void set_value(size_t index, uint64_t value) NOEXCEPT;
+    void push_output(const output::cptr& output) NOEXCEPT;
+    void erase_output(size_t index) NOEXCEPT;
+
+    /// Hashes (as transaction).
+    /// -----------------------------------------------------------------------
+
+    hash_digest hash(bool witness) const NOEXCEPT;
+    hash_digest outputs_hash() const NOEXCEPT;
+    hash_digest points_hash() const NOEXCEPT;
+    hash_digest sequences_hash() const NOEXCEPT;
+
+    /// Transaction sharing inputs and outputs, with computed hashes cached.
+    transaction to_transaction() const NOEXCEPT;
+
+private:
+    typedef accumulator<sha256> context;
+
+    // Hash state after each segment, of which the leading valid are current.
+    struct midstates
+    {
+        void invalidate(size_t position) NOEXCEPT;
+
+        std::vector<context> states{};
+        size_t valid{};
+        hash_digest digest{};
+        bool current{};
+    };
+
+    template <typename Write>
+    static const hash_digest& compute(midstates& cache, size_t count,
+        Write&& write) NOEXCEPT;
+
+    bool is_coinbase() const NOEXCEPT;
+    size_t output_position(size_t index) const NOEXCEPT;
+    size_t locktime_position(bool witness) const NOEXCEPT;
+    void invalidate_input(size_t index) NOEXCEPT;
+    void invalidate_output(size_t index) NOEXCEPT;
+    void write_segment(context& context, size_t position,
+        bool witness) const NOEXCEPT;
+
+    // Serialized segments, empty until computed.
+    const data_chunk& input_data(size_t index) const NOEXCEPT;
+    const data_chunk& output_data(size_t index) const NOEXCEPT;
+    const data_chunk& witness_data(size_t index) const NOEXCEPT;
+
+    uint32_t version_;
+    input_cptrs inputs_;
+    output_cptrs outputs_;
+    uint32_t locktime_;
+
+    mutable std::vector<data_chunk> inputs_data_;
+    mutable std::vector<data_chunk> outputs_data_;
+    mutable std::vector<data_chunk> witnesses_data_;
+
+    mutable midstates hash_{};
+    mutable midstates witness_hash_{};
+    mutable midstates outputs_hash_{};
+    mutable midstates points_hash_{};
+    mutable midstates sequences_hash_{};
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -28,6 +28,7 @@
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/serial/props_writer.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -60,6 +61,8 @@ public:
     witness(std::istream& stream, bool prefix) NOEXCEPT;
     witness(reader&& source, bool prefix) NOEXCEPT;
     witness(reader& source, bool prefix) NOEXCEPT;
+    witness(span_reader&& source, bool prefix) NOEXCEPT;
+    witness(span_reader& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     witness(const std::string& mnemonic) NOEXCEPT;
@@ -95,6 +98,7 @@ public:
 
     /// Skip a witness (as if deserialized).
     static void skip(reader& source, bool prefix) NOEXCEPT;
+    static void skip(span_reader& source, bool prefix) NOEXCEPT;
 
     static VCONSTEXPR bool is_push_size(const chunk_cptrs& stack) NOEXCEPT
     {
@@ -119,7 +123,10 @@ public:
 private:
     // TODO: move to config serialization wrapper.
     static witness from_string(const std::string& mnemonic) NOEXCEPT;
-    static witness from_data(reader& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    static witness from_data(Source& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    static void do_skip(Source& source, bool prefix) NOEXCEPT;
     size_t serialized_size() const NOEXCEPT;
 
     witness(chunk_cptrs&& stack, bool valid) NOEXCEPT;
@@ -135,6 +142,8 @@ typedef std::vector<witness> witnesses;
 DECLARE_JSON_VALUE_CONVERTORS(witness);
 DECLARE_JSON_VALUE_CONVERTORS(witness::cptr);
 
+BC_API void to_props(props_writer& writer, const witness& witness) NOEXCEPT;
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
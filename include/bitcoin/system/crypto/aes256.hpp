@@ -36,10 +36,20 @@ typedef data_array<block_size> block;
 constexpr size_t secret_size = bytes<256>;
 typedef data_array<secret_size> secret;
 
+typedef std_vector<block> blocks;
+
 /// Perform aes256 encryption/decryption on a data block.
 void encrypt(block& bytes, const secret& key) NOEXCEPT;
 void decrypt(block& bytes, const secret& key) NOEXCEPT;
 
+/// Perform aes256 encryption/decryption on each of a set of data blocks (ECB).
+/// The key is expanded once for the set. Native (AES-NI/VAES) intrinsics are
+/// used when compiled and available at runtime, with independent blocks
+/// interleaved to hide instruction latency. The scalar implementation is
+/// otherwise used, as it is for single blocks when intrinsics are unavailable.
+void encrypt(blocks& bytes, const secret& key) NOEXCEPT;
+void decrypt(blocks& bytes, const secret& key) NOEXCEPT;
+
 } // namespace aes256
 } // namespace system
 } // namespace libbitcoin
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CRYPTO_CHACHA20_HPP
+#define LIBBITCOIN_SYSTEM_CRYPTO_CHACHA20_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// ChaCha20 keystream generator (20 rounds, 64 bit counter and 64 bit nonce).
+/// The block function is that of RFC 8439, where the 32 bit IETF counter and
+/// first nonce word are combined as the 64 bit counter (original layout).
+/// This is a keystream source for random generation, not a stream cipher.
+class BC_API chacha20
+{
+public:
+    static constexpr size_t block_size = 64;
+    typedef data_array<block_size> block;
+
+    static constexpr size_t secret_size = 32;
+    typedef data_array<secret_size> secret;
+
+    /// Keystream starts at the given block counter.
+    chacha20(const secret& key, uint64_t nonce=0, uint64_t counter=0) NOEXCEPT;
+
+    /// Write the next keystream block.
+    void generate(block& out) NOEXCEPT;
+
+    /// Write the next whole keystream blocks (out.size() / block_size) to out,
+    /// as little-endian words. Returns the number of bytes written.
+    size_t generate(const data_slab& out) NOEXCEPT;
+
+private:
+    typedef std_array<uint32_t, 16> state;
+
+    void next(uint8_t* out) NOEXCEPT;
+
+    state state_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
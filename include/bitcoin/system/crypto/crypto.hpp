@@ -20,10 +20,13 @@
 #define LIBBITCOIN_SYSTEM_CRYPTO_CRYPTO_HPP
 
 #include <bitcoin/system/crypto/aes256.hpp>
+#include <bitcoin/system/crypto/chacha20.hpp>
 #include <bitcoin/system/crypto/der_parser.hpp>
 #include <bitcoin/system/crypto/golomb_coding.hpp>
 #include <bitcoin/system/crypto/pseudo_random.hpp>
 #include <bitcoin/system/crypto/ring_signature.hpp>
 #include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/crypto/secure_random.hpp>
+#include <bitcoin/system/crypto/signature_cache.hpp>
 
 #endif
@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CRYPTO_SECURE_RANDOM_HPP
+#define LIBBITCOIN_SYSTEM_CRYPTO_SECURE_RANDOM_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Cryptographically secure random generation, for nonces, keys and salts.
+/// Each thread has a ChaCha20 keystream generator keyed from operating system
+/// entropy (std::random_device). Keystream is buffered, and the generator is
+/// rekeyed from its own keystream on each refill (fast key erasure), so prior
+/// output cannot be recovered from generator state. Bulk requests are written
+/// directly in whole blocks. Use pseudo_random for non-cryptographic needs.
+class BC_API secure_random
+{
+public:
+    /// Fill a byte array or vector with randomness.
+    static void fill(const data_slab& out) NOEXCEPT;
+
+    /// Generate a random number within the uint64_t domain.
+    static uint64_t next() NOEXCEPT;
+
+    /// Generate a uniformly-distributed random number within [begin, end].
+    /// Returns zero if begin > end.
+    static uint64_t next(uint64_t begin, uint64_t end) NOEXCEPT;
+
+    /// Rekey the calling thread's generator from operating system entropy.
+    static void reseed() NOEXCEPT;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CRYPTO_SIGNATURE_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_CRYPTO_SIGNATURE_CACHE_HPP
+
+#include <atomic>
+#include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Fixed-memory, lock-free cache of successful ECDSA verifications.
+/// Entries are salted hashes of (point, hash, signature), each with two
+/// candidate slots (cuckoo hashing). Insertion displaces at most 'kicks'
+/// occupants to their alternate slots before evicting the last displaced.
+/// Slots are sequence-locked, so a contended slot is skipped (a cache miss),
+/// and a torn entry is never observed. Only successful verification is cached.
+/// The cache is passed to script evaluation (transaction or block connect),
+/// and must remain in scope for the duration of the call.
+class BC_API signature_cache
+{
+public:
+    DELETE_COPY_MOVE(signature_cache);
+
+    /// Default maximum displacements per insertion.
+    static constexpr size_t default_kicks = 8;
+
+    /// Randomly salted, capacity is the number of entry slots.
+    signature_cache(size_t capacity, size_t kicks=default_kicks) NOEXCEPT;
+
+    /// Explicitly salted (deterministic, for testing).
+    signature_cache(size_t capacity, size_t kicks,
+        const hash_digest& salt) NOEXCEPT;
+
+    /// Verify signature against the cache, fall back to full verification.
+    bool verify(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature) NOEXCEPT;
+
+    /// True if verification is cached (counts a hit or a miss).
+    bool contains(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature) const NOEXCEPT;
+
+    /// Record a successful verification (best effort).
+    void insert(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature) NOEXCEPT;
+
+    /// Properties.
+    size_t capacity() const NOEXCEPT;
+    size_t kicks() const NOEXCEPT;
+    size_t hits() const NOEXCEPT;
+    size_t misses() const NOEXCEPT;
+    size_t evictions() const NOEXCEPT;
+
+protected:
+    typedef std_array<uint64_t, 4> entry;
+
+    entry key(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature) const NOEXCEPT;
+
+    bool find(const entry& value) const NOEXCEPT;
+    void store(const entry& value) NOEXCEPT;
+
+private:
+    struct slot
+    {
+        // Even when stable, odd while writing, zero when never written.
+        // Sixty four bits, so the sequence does not wrap back to vacant.
+        std::atomic<uint64_t> sequence{};
+        std_array<std::atomic<uint64_t>, 4> words{};
+    };
+
+    size_t first(const entry& value) const NOEXCEPT;
+    size_t second(const entry& value) const NOEXCEPT;
+    size_t alternate(const entry& value, size_t index) const NOEXCEPT;
+    bool is_cached(const entry& value) const NOEXCEPT;
+    bool is_vacant(size_t index) const NOEXCEPT;
+    bool read(entry& out, size_t index) const NOEXCEPT;
+    bool write(size_t index, const entry& value) NOEXCEPT;
+
+    // These are thread safe.
+    const size_t kicks_;
+    const hash_digest salt_;
+    std_vector<slot> slots_;
+    mutable std::atomic<size_t> hits_{};
+    mutable std::atomic<size_t> misses_{};
+    std::atomic<size_t> evictions_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
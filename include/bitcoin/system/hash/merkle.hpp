@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_MERKLE_HPP
+#define LIBBITCOIN_SYSTEM_HASH_MERKLE_HPP
+
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/functions.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Bitcoin merkle tree (sha256 double hash, odd levels duplicate the last).
+/// All levels are retained in one contiguous array (leaves first, root last)
+/// so that any number of proofs are produced without rehashing. Levels are
+/// computed with sha256::merkle_hash, which is vectorized where available.
+class BC_API merkle_tree
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(merkle_tree);
+
+    /// Inclusion proof of the leaf at index, siblings ordered from leaf.
+    struct proof
+    {
+        size_t index;
+        hashes branch;
+    };
+
+    typedef std::vector<proof> proofs;
+
+    /// Partial merkle tree (bip37), as carried by the merkleblock message.
+    /// Flags are in traversal order, serialization packs them lsb first.
+    struct partial
+    {
+        size_t leaves;
+        hashes nodes;
+        std::vector<bool> flags;
+    };
+
+    /// Compute the root from a leaf and its proof.
+    static hash_digest root(const hash_digest& leaf,
+        const proof& proof) NOEXCEPT;
+
+    /// Verify a leaf and its proof against the root.
+    static bool verify(const hash_digest& root, const hash_digest& leaf,
+        const proof& proof) NOEXCEPT;
+
+    /// Verify leaves and their proofs against the root, hashing the nodes of
+    /// all proofs at each level together. False if counts differ or empty.
+    static bool verify(const hash_digest& root, const hashes& leaves,
+        const proofs& proofs) NOEXCEPT;
+
+    /// Verify a partial tree against the root, extracting matched leaves and
+    /// their indexes. False if malformed, including duplicated subtrees.
+    static bool verify(const hash_digest& root, const partial& tree,
+        hashes& matches, std::vector<size_t>& indexes) NOEXCEPT;
+
+    /// Constructors.
+    /// -----------------------------------------------------------------------
+
+    merkle_tree(hashes&& leaves) NOEXCEPT;
+    merkle_tree(const hashes& leaves) NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    /// Root is null_hash for an empty tree (as sha256::merkle_root).
+    hash_digest root() const NOEXCEPT;
+    size_t leaves() const NOEXCEPT;
+    size_t depth() const NOEXCEPT;
+
+    /// Methods.
+    /// -----------------------------------------------------------------------
+
+    /// Proof of leaf at index (empty branch if index is out of range).
+    proof prove(size_t index) const NOEXCEPT;
+
+    /// Proofs of leaves at indexes, generated concurrently.
+    proofs prove(const std::vector<size_t>& indexes) const NOEXCEPT;
+
+    /// Proofs of leaves by value (e.g. txids), false if any is not a leaf.
+    /// Of duplicated leaves the first is proven.
+    bool prove(proofs& out, const hashes& leaves) const NOEXCEPT;
+
+    /// Partial tree of the leaves flagged as matched (bip37).
+    /// Matches beyond the leaf count are ignored, an empty tree is empty.
+    partial prune(const std::vector<bool>& matches) const NOEXCEPT;
+
+private:
+    const hash_digest& node(size_t height, size_t position) const NOEXCEPT;
+    void build() NOEXCEPT;
+    void traverse(partial& out, const std::vector<bool>& matches,
+        size_t height, size_t position) const NOEXCEPT;
+
+    // Level offsets into nodes_, leaves at zero, root last.
+    hashes nodes_;
+    std::vector<size_t> levels_;
+    size_t leaves_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
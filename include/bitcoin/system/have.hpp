@@ -105,6 +105,16 @@
     #endif
 #endif
 
+/// Native 128 bit unsigned integer (GCC/Clang on 64 bit targets).
+#if defined(__SIZEOF_INT128__) && (defined(HAVE_GNUC) || defined(HAVE_CLANG))
+    #define HAVE_INT128
+#endif
+
+/// 64x64->128 bit multiply and 128/64->64 bit divide intrinsics.
+#if defined(HAVE_MSC) && defined(HAVE_X64)
+    #define HAVE_XMUL128
+#endif
+
 /// XCPU architecture inline assembly.
 #if defined(HAVE_XCPU) && !defined(HAVE_MSC)
     #define HAVE_XASSEMBLY
@@ -128,7 +138,7 @@
     #define HAVE_ICU
 #endif
 
-/// XCPU architecture intrinsics sse41, avx2, avx512f, sha-ni.
+/// XCPU architecture intrinsics sse41, avx2, avx512f, sha-ni, aes-ni, vaes.
 /// All require runtime evaluation, as the binary is portable across XCPUs.
 #if defined(HAVE_XCPU)
     // TODO: CLANG/GCC compile test and set -msse4 -mavx2 -mavx512f -msha.
@@ -146,6 +156,12 @@
         #if defined (WITH_SHANI)
             #define HAVE_SHANI
         #endif
+        #if defined (WITH_AESNI)
+            #define HAVE_AESNI
+        #endif
+        #if defined (WITH_VAES)
+            #define HAVE_VAES
+        #endif
     #endif
     // Always available without platform test or build configuration.
     #if defined(HAVE_MSC)
@@ -153,6 +169,8 @@
         #define HAVE_AVX2
         #define HAVE_AVX512
         #define HAVE_SHANI
+        #define HAVE_AESNI
+        #define HAVE_VAES
     #endif
 #endif
 
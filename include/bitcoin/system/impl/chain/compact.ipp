@@ -99,14 +99,14 @@ compact::expand(small_type exponential) NOEXCEPT
     }
 
     // Above exists only because negatives were inadvertently excluded.
-    
-    return base256e::expand(from_compact(compact));
+
+    return base256e::expand<span_type>(from_compact(compact));
 }
 
 constexpr compact::small_type
 compact::compress(const span_type& number) NOEXCEPT
 {
-    auto compact = to_compact(base256e::compress(number));
+    auto compact = to_compact(base256e::compress<span_type>(number));
 
     // Below exists only to work around negatives being inadvertently excluded.
 
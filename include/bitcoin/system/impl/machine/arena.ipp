@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_ARENA_IPP
+#define LIBBITCOIN_SYSTEM_MACHINE_ARENA_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+// arena_stack
+// ----------------------------------------------------------------------------
+// Elements are trivially copyable and destructible, so the buffer is neither
+// initialized nor destroyed, and only the populated range is ever copied.
+
+BC_PUSH_WARNING(NO_UNINITIALZIED_MEMBER)
+
+INLINE arena_stack::arena_stack() NOEXCEPT
+  : size_{}
+{
+}
+
+// Value-initialized elements (projection of witness stack).
+INLINE arena_stack::arena_stack(size_t count) NOEXCEPT
+  : size_{ count }
+{
+    BC_ASSERT_MSG(count <= arena_capacity, "arena stack overflow");
+    std::uninitialized_value_construct_n(data(), size_);
+}
+
+INLINE arena_stack::arena_stack(const arena_stack& other) NOEXCEPT
+  : size_{ other.size_ }
+{
+    std::uninitialized_copy_n(other.data(), size_, data());
+}
+
+INLINE arena_stack::arena_stack(arena_stack&& other) NOEXCEPT
+  : arena_stack(other)
+{
+}
+
+BC_POP_WARNING()
+
+INLINE arena_stack& arena_stack::operator=(const arena_stack& other) NOEXCEPT
+{
+    size_ = other.size_;
+    std::copy_n(other.data(), size_, data());
+    return *this;
+}
+
+INLINE arena_stack& arena_stack::operator=(arena_stack&& other) NOEXCEPT
+{
+    return *this = other;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+INLINE bool arena_stack::empty() const NOEXCEPT
+{
+    return is_zero(size_);
+}
+
+INLINE size_t arena_stack::size() const NOEXCEPT
+{
+    return size_;
+}
+
+// Iteration.
+// ----------------------------------------------------------------------------
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+INLINE arena_stack::iterator arena_stack::begin() NOEXCEPT
+{
+    return data();
+}
+
+INLINE arena_stack::iterator arena_stack::end() NOEXCEPT
+{
+    return data() + size_;
+}
+
+INLINE arena_stack::const_iterator arena_stack::begin() const NOEXCEPT
+{
+    return data();
+}
+
+INLINE arena_stack::const_iterator arena_stack::end() const NOEXCEPT
+{
+    return data() + size_;
+}
+
+// Access.
+// ----------------------------------------------------------------------------
+
+INLINE arena_stack::value_type& arena_stack::back() NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    return data()[sub1(size_)];
+}
+
+INLINE const arena_stack::value_type& arena_stack::back() const NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    return data()[sub1(size_)];
+}
+
+INLINE arena_stack::value_type& arena_stack::operator[](
+    size_t index) NOEXCEPT
+{
+    BC_ASSERT(index < size_);
+    return data()[index];
+}
+
+INLINE const arena_stack::value_type& arena_stack::operator[](
+    size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < size_);
+    return data()[index];
+}
+
+// Mutation.
+// ----------------------------------------------------------------------------
+
+INLINE void arena_stack::clear() NOEXCEPT
+{
+    size_ = zero;
+}
+
+INLINE void arena_stack::pop_back() NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    --size_;
+}
+
+INLINE void arena_stack::push_back(const value_type& value) NOEXCEPT
+{
+    emplace_back(value);
+}
+
+INLINE arena_stack::iterator arena_stack::erase(
+    const_iterator position) NOEXCEPT
+{
+    BC_ASSERT(position >= begin() && position < end());
+    const auto it = begin() + (position - begin());
+    std::copy(std::next(it), end(), it);
+    --size_;
+    return it;
+}
+
+template <typename... Args>
+INLINE void arena_stack::emplace_back(Args&&... args) NOEXCEPT
+{
+    BC_ASSERT_MSG(size_ < arena_capacity, "arena stack overflow");
+    std::construct_at(data() + size_++, std::forward<Args>(args)...);
+}
+
+BC_POP_WARNING()
+
+// private
+// ----------------------------------------------------------------------------
+
+BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+
+INLINE arena_stack::value_type* arena_stack::data() NOEXCEPT
+{
+    return reinterpret_cast<value_type*>(buffer_.data());
+}
+
+INLINE const arena_stack::value_type* arena_stack::data() const NOEXCEPT
+{
+    return reinterpret_cast<const value_type*>(buffer_.data());
+}
+
+BC_POP_WARNING()
+
+// chunk_arena
+// ----------------------------------------------------------------------------
+
+// static
+INLINE chunk_arena& chunk_arena::local() NOEXCEPT
+{
+    // Slot buffers are allocated on first use and retained for the thread.
+    static thread_local chunk_arena arena{};
+    return arena;
+}
+
+INLINE chunk_arena::chunk_arena() NOEXCEPT
+  : position_{}, slots_{}
+{
+}
+
+INLINE void chunk_arena::reset() NOEXCEPT
+{
+    position_ = zero;
+}
+
+INLINE size_t chunk_arena::size() const NOEXCEPT
+{
+    return position_;
+}
+
+INLINE chunk_xptr chunk_arena::assign(const data_slice& value,
+    tether<data_chunk>& overflow) NOEXCEPT
+{
+    if (position_ == arena_chunks)
+        return make_external(to_chunk(value), overflow);
+
+    // Assignment reuses slot capacity, allocating only on growth.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+    auto& slot = slots_[position_++];
+    slot.assign(value.begin(), value.end());
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    return { &slot };
+}
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -946,7 +946,7 @@ op_ripemd160() NOEXCEPT
     if (state::is_stack_empty())
         return error::op_ripemd160;
 
-    state::push_chunk(rmd160_chunk(*state::pop_chunk_()));
+    state::push_copy(rmd160_hash(*state::pop_chunk_()));
     return error::op_success;
 }
 
@@ -957,7 +957,7 @@ op_sha1() NOEXCEPT
     if (state::is_stack_empty())
         return error::op_sha1;
 
-    state::push_chunk(sha1_chunk(*state::pop_chunk_()));
+    state::push_copy(sha1_hash(*state::pop_chunk_()));
     return error::op_success;
 }
 
@@ -968,7 +968,7 @@ op_sha256() NOEXCEPT
     if (state::is_stack_empty())
         return error::op_sha256;
 
-    state::push_chunk(sha256_chunk(*state::pop_chunk_()));
+    state::push_copy(sha256_hash(*state::pop_chunk_()));
     return error::op_success;
 }
 
@@ -979,7 +979,7 @@ op_hash160() NOEXCEPT
     if (state::is_stack_empty())
         return error::op_hash160;
 
-    state::push_chunk(bitcoin_short_chunk(*state::pop_chunk_()));
+    state::push_copy(bitcoin_short_hash(*state::pop_chunk_()));
     return error::op_success;
 }
 
@@ -990,7 +990,7 @@ op_hash256() NOEXCEPT
     if (state::is_stack_empty())
         return error::op_hash256;
 
-    state::push_chunk(bitcoin_chunk(*state::pop_chunk_()));
+    state::push_copy(bitcoin_hash(*state::pop_chunk_()));
     return error::op_success;
 }
 
@@ -1049,7 +1049,7 @@ op_check_sig_verify() NOEXCEPT
         return error::op_check_sig_verify_parse;
 
     // TODO: for signing mode - make key mutable and return above.
-    return system::verify_signature(*key, hash, sig) ?
+    return state::verify(*key, hash, sig) ?
         error::op_success : error::op_check_sig_verify4;
 }
 
@@ -1139,7 +1139,7 @@ op_check_multisig_verify() NOEXCEPT
             BC_POP_WARNING()
 
             // TODO: for signing mode - make key mutable and return above.
-            if (system::verify_signature(*key, hash, sig))
+            if (state::verify(*key, hash, sig))
                 ++endorsement;
         }
     }
@@ -1227,13 +1227,38 @@ op_check_sequence_verify() const NOEXCEPT
 // ----------------------------------------------------------------------------
 // It is expected that the compiler will produce a very efficient jump table.
 
-// private:
+// protected
 template <typename Stack>
 op_error_t interpreter<Stack>::
 run_op(const op_iterator& op) NOEXCEPT
 {
-    const auto code = op->code();
+    return dispatch(op->code(), op);
+}
 
+// protected
+// The constant opcode reduces the inlined dispatch switch to a direct call.
+template <typename Stack>
+template <opcode Code>
+op_error_t interpreter<Stack>::
+run_code(const op_iterator& op) NOEXCEPT
+{
+    return dispatch(Code, op);
+}
+
+// private
+template <typename Stack>
+template <size_t... Code>
+constexpr typename interpreter<Stack>::handlers interpreter<Stack>::
+make_handlers(std::index_sequence<Code...>) NOEXCEPT
+{
+    return { &interpreter::template run_code<static_cast<opcode>(Code)>... };
+}
+
+// private
+template <typename Stack>
+INLINE op_error_t interpreter<Stack>::
+dispatch(opcode code, const op_iterator& op) NOEXCEPT
+{
     switch (code)
     {
         case opcode::push_size_0:
@@ -1584,14 +1609,97 @@ run() NOEXCEPT
         error::invalid_stack_scope;
 }
 
+// Pre-decoded execution.
+// ----------------------------------------------------------------------------
+// Opcode properties are resolved once per script (not once per run), and each
+// instruction carries the address of its opcode-specific handler, so run is a
+// single indirect call per executed operation, with no dispatch switch.
+
+// static
+template <typename Stack>
+typename interpreter<Stack>::instructions interpreter<Stack>::
+decode(const script& script) NOEXCEPT
+{
+    const auto& ops = script.ops();
+    instructions stream{};
+    stream.reserve(ops.size());
+
+    BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+    for (auto it = ops.begin(); it != ops.end(); ++it)
+    {
+        const auto code = it->code();
+        stream.push_back(
+        {
+            handlers_[static_cast<uint8_t>(code)],
+            it,
+            operation::is_invalid(code),
+            it->is_oversized(),
+            operation::is_conditional(code)
+        });
+    }
+    BC_POP_WARNING()
+
+    return stream;
+}
+
+// The stream must be decoded from the script of this program.
 template <typename Stack>
 code interpreter<Stack>::
-connect(const context& state, const transaction& tx, uint32_t index) NOEXCEPT
+run(const instructions& stream) NOEXCEPT
+{
+    BC_ASSERT(stream.empty() || stream.front().op == state::begin());
+
+    error::op_error_t operation_ec;
+    error::script_error_t script_ec;
+
+    // Enforce script size limit (10,000) [0.3.7+].
+    // Enforce initial primary stack size limit (520) [bip141].
+    // Enforce first op not reserved (not skippable by condition).
+    if ((script_ec = state::validate()))
+        return script_ec;
+
+    for (const auto& step: stream)
+    {
+        // Enforce unconditionally invalid opcodes ("disabled").
+        if (step.invalid)
+            return error::op_invalid;
+
+        // Rule imposed by [0.3.6] soft fork.
+        if (step.oversized)
+            return error::invalid_push_data_size;
+
+        // Enforce opcode count limit (201).
+        if (!state::ops_increment(*step.op))
+            return error::invalid_operation_count;
+
+        // Conditional evaluation scope.
+        if (step.conditional || state::is_succeess())
+        {
+            // Evaluate opcode (direct handler).
+            if ((operation_ec = (this->*step.run)(step.op)))
+                return operation_ec;
+
+            // Enforce combined stacks size limit (1,000).
+            if (state::is_stack_overflow())
+                return error::invalid_stack_size;
+        }
+    }
+
+    // Guard against unbalanced evaluation scope.
+    return state::is_balanced() ? error::script_success :
+        error::invalid_stack_scope;
+}
+
+template <typename Stack>
+code interpreter<Stack>::
+connect(const context& state, const transaction& tx, uint32_t index,
+    signature_cache* signatures) NOEXCEPT
 {
     if (index >= tx.inputs_ptr()->size())
         return error::inputs_overflow;
 
-    return connect(state, tx, std::next(tx.inputs_ptr()->begin(), index));
+    return connect(state, tx, std::next(tx.inputs_ptr()->begin(), index),
+        signatures);
 }
 
 // TODO: Implement original op_codeseparator concatenation [< 0.3.6].
@@ -1599,15 +1707,28 @@ connect(const context& state, const transaction& tx, uint32_t index) NOEXCEPT
 template <typename Stack>
 code interpreter<Stack>::
 connect(const context& state, const transaction& tx,
-    const input_iterator& it) NOEXCEPT
+    const input_iterator& it, signature_cache* signatures) NOEXCEPT
 {
     code ec;
     const auto& input = **it;
     if (!input.prevout)
         return error::missing_previous_output;
 
+    // Chunks issued to the prior input's programs are released for reuse.
+    // The arena holds the combined stack limit (plus single op growth), but a
+    // witness may initialize a larger stack (reducible before the limit is
+    // enforced), so that input is evaluated using an unbounded stack.
+    if constexpr (is_same_type<Stack, arena_stack>)
+    {
+        if (input.witness().stack().size() > max_stack_size)
+            return interpreter<contiguous_stack>::connect(state, tx, it,
+                signatures);
+
+        chunk_arena::local().reset();
+    }
+
     // Evaluate input script.
-    interpreter in_program(tx, it, state.forks);
+    interpreter in_program(tx, it, state.forks, signatures);
     if ((ec = in_program.run()))
         return ec;
 
@@ -1625,7 +1746,7 @@ connect(const context& state, const transaction& tx,
     else if (prevout->is_pay_to_script_hash(state.forks))
     {
         // Because output script pushed script hash program (bip16).
-        if ((ec = connect_embedded(state, tx, it, in_program)))
+        if ((ec = connect_embedded(state, tx, it, in_program, signatures)))
             return ec;
     }
     else if (prevout->is_pay_to_witness(state.forks))
@@ -1635,7 +1756,7 @@ connect(const context& state, const transaction& tx,
             return error::dirty_witness;
 
         // Because output script pushed version and witness program (bip141).
-        if ((ec = connect_witness(state, tx, it, *prevout)))
+        if ((ec = connect_witness(state, tx, it, *prevout, signatures)))
             return ec;
     }
     else if (!input.witness().stack().empty())
@@ -1653,7 +1774,7 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 template <typename Stack>
 code interpreter<Stack>::connect_embedded(const context& state,
     const transaction& tx, const input_iterator& it,
-    interpreter& in_program) NOEXCEPT
+    interpreter& in_program, signature_cache* signatures) NOEXCEPT
 {
     code ec;
     const auto& input = **it;
@@ -1681,7 +1802,7 @@ code interpreter<Stack>::connect_embedded(const context& state,
             return error::dirty_witness;
 
         // Because output script pushed version/witness program (bip141).
-        if ((ec = connect_witness(state, tx, it, *prevout)))
+        if ((ec = connect_witness(state, tx, it, *prevout, signatures)))
             return ec;
     }
     else if (!input.witness().stack().empty())
@@ -1699,7 +1820,7 @@ BC_POP_WARNING()
 template <typename Stack>
 code interpreter<Stack>::connect_witness(const context&state,
     const transaction& tx, const input_iterator& it,
-    const script& prevout) NOEXCEPT
+    const script& prevout, signature_cache* signatures) NOEXCEPT
 {
     const auto& input = **it;
     const auto version = prevout.version();
@@ -1716,7 +1837,8 @@ code interpreter<Stack>::connect_witness(const context&state,
                 return error::invalid_witness;
 
             // A defined version indicates bip141 is active.
-            interpreter program(tx, it, script, state.forks, version, stack);
+            interpreter program(tx, it, script, state.forks, version, stack,
+                signatures);
             if ((ec = program.run()))
                 return ec;
 
@@ -45,7 +45,7 @@ using namespace system::error;
 template <typename Stack>
 inline program<Stack>::
 program(const chain::transaction& tx, const input_iterator& input,
-     uint32_t forks) NOEXCEPT
+     uint32_t forks, signature_cache* signatures) NOEXCEPT
   : transaction_(tx),
     input_(input),
     script_((*input)->script_ptr()),
@@ -53,6 +53,7 @@ program(const chain::transaction& tx, const input_iterator& input,
     value_(max_uint64),
     version_(script_version::unversioned),
     witness_(),
+    signatures_(signatures),
     primary_()
 {
 }
@@ -71,6 +72,7 @@ program(const program& other, const script::cptr& script) NOEXCEPT
     value_(other.value_),
     version_(other.version_),
     witness_(),
+    signatures_(other.signatures_),
     primary_(other.primary_)
 {
 }
@@ -86,6 +88,7 @@ program(program&& other, const script::cptr& script) NOEXCEPT
     value_(other.value_),
     version_(other.version_),
     witness_(),
+    signatures_(other.signatures_),
     primary_(std::move(other.primary_))
 {
 }
@@ -98,7 +101,7 @@ template <typename Stack>
 inline program<Stack>::
 program(const chain::transaction& tx, const input_iterator& input,
     const script::cptr& script, uint32_t forks, script_version version,
-    const chunk_cptrs_ptr& witness) NOEXCEPT
+    const chunk_cptrs_ptr& witness, signature_cache* signatures) NOEXCEPT
   : transaction_(tx),
     input_(input),
     script_(script),
@@ -106,6 +109,7 @@ program(const chain::transaction& tx, const input_iterator& input,
     value_((*input)->prevout->value()),
     version_(version),
     witness_(witness),
+    signatures_(signatures),
     primary_(projection<Stack>(*witness))
 {
 }
@@ -261,6 +265,14 @@ push_chunk(const chunk_xptr& datum) NOEXCEPT
     primary_.emplace_chunk(datum);
 }
 
+// Computed values (hashes) are copied, to the thread arena if arena_stack.
+template <typename Stack>
+INLINE void program<Stack>::
+push_copy(const data_slice& datum) NOEXCEPT
+{
+    primary_.emplace_copy(datum);
+}
+
 template <typename Stack>
 INLINE void program<Stack>::
 push_bool(bool value) NOEXCEPT
@@ -801,6 +813,16 @@ prepare(ec_signature& signature, const data_chunk&, hash_cache& cache,
     return parse_signature(signature, distinguished, bip66);
 }
 
+// Signature cache is provided by the caller, shared across transactions.
+template <typename Stack>
+inline bool program<Stack>::
+verify(const data_slice& key, const hash_digest& hash,
+    const ec_signature& signature) const NOEXCEPT
+{
+    return is_null(signatures_) ? verify_signature(key, hash, signature) :
+        signatures_->verify(key, hash, signature);
+}
+
 // Signature hashing.
 // ----------------------------------------------------------------------------
 
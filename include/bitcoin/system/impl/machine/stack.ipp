@@ -88,7 +88,7 @@ template <typename Container>
 INLINE void stack<Container>::push(data_chunk&& value) NOEXCEPT
 {
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    container_.push_back(make_external(std::move(value), tether_));
+    container_.push_back(make_chunk(std::move(value)));
     BC_POP_WARNING()
 }
 
@@ -132,6 +132,18 @@ INLINE void stack<Container>::emplace_chunk(const chunk_xptr& value) NOEXCEPT
     BC_POP_WARNING()
 }
 
+// Copies bytes to a new chunk, avoiding allocation when arena-backed.
+template <typename Container>
+INLINE void stack<Container>::emplace_copy(const data_slice& value) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    if constexpr (arena_)
+        container_.emplace_back(chunk_arena::local().assign(value, tether_));
+    else
+        container_.emplace_back(make_external(to_chunk(value), tether_));
+    BC_POP_WARNING()
+}
+
 // Positional (stack cheats).
 // ----------------------------------------------------------------------------
 // These optimizations prevent used of std::stack.
@@ -149,7 +161,7 @@ INLINE void stack<Container>::swap(size_t left_index,
 {
     BC_ASSERT(left_index < size() && right_index < size());
 
-    if constexpr (vector_)
+    if constexpr (indexed_)
     {
         const auto back = sub1(size());
         std::swap(
@@ -171,7 +183,7 @@ INLINE const stack_variant& stack<Container>::peek(size_t index) const NOEXCEPT
 {
     BC_ASSERT(index < size());
 
-    if constexpr (vector_)
+    if constexpr (indexed_)
         return container_[sub1(size()) - index];
 
     if constexpr (linked_)
@@ -298,12 +310,12 @@ inline chunk_xptr stack<Container>::peek_chunk() const NOEXCEPT
         [&, this](bool vary) NOEXCEPT
         {
             // This is never executed in standard scripts.
-            value = make_external(chunk::from_bool(vary), tether_);
+            value = make_chunk(chunk::from_bool(vary));
         },
         [&](int64_t vary) NOEXCEPT
         {
             // This is never executed in standard scripts.
-            value = make_external(chunk::from_integer(vary), tether_);
+            value = make_chunk(chunk::from_integer(vary));
         },
         [&](const chunk_xptr& vary) NOEXCEPT
         {
@@ -344,6 +356,16 @@ inline size_t stack<Container>::peek_size() const NOEXCEPT
     return value;
 }
 
+// private
+template <typename Container>
+inline chunk_xptr stack<Container>::make_chunk(data_chunk&& value) const NOEXCEPT
+{
+    if constexpr (arena_)
+        return chunk_arena::local().assign(value, tether_);
+    else
+        return make_external(std::move(value), tether_);
+}
+
 /// Static variant compare with conversion.
 /// Integers are unconstrained as these are stack chunk equality comparisons.
 template <typename Container>
@@ -426,6 +448,10 @@ inline bool stack<Container>::equal_chunks(const stack_variant& left,
 
 // Tethering Considerations
 //
+// When the container is arena_stack, chunks that would otherwise be tethered
+// are copied into the calling thread's chunk_arena, which is reset at the
+// start of each input connect. Only arena overflow is tethered.
+//
 // Hash results and int/bool->chunks are saved using a shared_ptr vector.
 // The tether is not garbage-collected (until destruct) as this is a space-
 // time performance tradeoff. The maximum number of constructable chunks is
@@ -0,0 +1,536 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_FIXED_UINT256_IPP
+#define LIBBITCOIN_SYSTEM_MATH_FIXED_UINT256_IPP
+
+#include <bit>
+#include <compare>
+#include <ostream>
+#include <type_traits>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Words are little-endian (words_[0] is least significant), so hash bytes
+// (little-endian, as in to_uintx) map directly to words without reversal.
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+constexpr fixed_uint256::fixed_uint256() NOEXCEPT
+  : words_{}
+{
+}
+
+constexpr fixed_uint256::fixed_uint256(uint64_t value) NOEXCEPT
+  : words_{ value, 0, 0, 0 }
+{
+}
+
+constexpr fixed_uint256::fixed_uint256(const word_array& words) NOEXCEPT
+  : words_{ words }
+{
+}
+
+constexpr fixed_uint256::fixed_uint256(const byte_array& bytes) NOEXCEPT
+  : words_{}
+{
+    for (size_t word = 0; word < words; ++word)
+        for (size_t byte = 0; byte < sizeof(uint64_t); ++byte)
+            words_[word] |= shift_left<uint64_t>(
+                bytes[word * sizeof(uint64_t) + byte], to_bits(byte));
+}
+
+constexpr fixed_uint256::fixed_uint256(const uint256_t& value) NOEXCEPT
+  : words_{}
+{
+    constexpr uint256_t mask{ max_uint64 };
+    for (size_t word = 0; word < words; ++word)
+        words_[word] = static_cast<uint64_t>(
+            (value >> to_bits(word * sizeof(uint64_t))) & mask);
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+constexpr const fixed_uint256::word_array&
+fixed_uint256::data() const NOEXCEPT
+{
+    return words_;
+}
+
+constexpr size_t fixed_uint256::bit_width() const NOEXCEPT
+{
+    for (auto word = words; word > 0; --word)
+        if (!is_zero(words_[sub1(word)]))
+            return to_bits(sub1(word) * sizeof(uint64_t)) +
+                std::bit_width(words_[sub1(word)]);
+
+    return zero;
+}
+
+// Conversions.
+// ----------------------------------------------------------------------------
+
+constexpr fixed_uint256::byte_array fixed_uint256::to_bytes() const NOEXCEPT
+{
+    byte_array bytes{};
+    for (size_t word = 0; word < words; ++word)
+        for (size_t byte = 0; byte < sizeof(uint64_t); ++byte)
+            bytes[word * sizeof(uint64_t) + byte] = narrow_cast<uint8_t>(
+                shift_right(words_[word], to_bits(byte)));
+
+    return bytes;
+}
+
+constexpr uint256_t fixed_uint256::to_uintx() const NOEXCEPT
+{
+    uint256_t value{};
+    for (auto word = words; word > 0; --word)
+    {
+        value <<= bits / words;
+        value |= words_[sub1(word)];
+    }
+
+    return value;
+}
+
+template <typename Integral, if_unsigned_integral_integer<Integral>>
+constexpr fixed_uint256::operator Integral() const NOEXCEPT
+{
+    return static_cast<Integral>(words_[0]);
+}
+
+// Operators.
+// ----------------------------------------------------------------------------
+
+constexpr fixed_uint256& fixed_uint256::operator+=(
+    const fixed_uint256& value) NOEXCEPT
+{
+    uint64_t carry{};
+    for (size_t word = 0; word < words; ++word)
+    {
+        const auto sum = words_[word] + value.words_[word];
+        const auto out = to_int<uint64_t>(sum < words_[word]);
+        words_[word] = sum + carry;
+        carry = out + to_int<uint64_t>(words_[word] < carry);
+    }
+
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator-=(
+    const fixed_uint256& value) NOEXCEPT
+{
+    uint64_t borrow{};
+    for (size_t word = 0; word < words; ++word)
+    {
+        const auto difference = words_[word] - value.words_[word];
+        const auto out = to_int<uint64_t>(difference > words_[word]);
+        words_[word] = difference - borrow;
+        borrow = out + to_int<uint64_t>(words_[word] > difference);
+    }
+
+    return *this;
+}
+
+// Truncated (mod 2^256) schoolbook multiply of 64 bit words.
+constexpr fixed_uint256& fixed_uint256::operator*=(
+    const fixed_uint256& value) NOEXCEPT
+{
+    word_array product{};
+    for (size_t left = 0; left < words; ++left)
+    {
+        if (is_zero(words_[left]))
+            continue;
+
+        uint64_t carry{};
+        for (size_t right = 0; left + right < words; ++right)
+        {
+            const auto part = multiply(words_[left], value.words_[right]);
+            auto& word = product[left + right];
+            word += part.low;
+            auto high = part.high + to_int<uint64_t>(word < part.low);
+            word += carry;
+            high += to_int<uint64_t>(word < carry);
+            carry = high;
+        }
+    }
+
+    words_ = product;
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator/=(
+    const fixed_uint256& value) NOEXCEPT
+{
+    fixed_uint256 remainder{};
+    divide(*this, remainder, *this, value);
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator%=(
+    const fixed_uint256& value) NOEXCEPT
+{
+    fixed_uint256 quotient{};
+    divide(quotient, *this, *this, value);
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator&=(
+    const fixed_uint256& value) NOEXCEPT
+{
+    for (size_t word = 0; word < words; ++word)
+        words_[word] &= value.words_[word];
+
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator|=(
+    const fixed_uint256& value) NOEXCEPT
+{
+    for (size_t word = 0; word < words; ++word)
+        words_[word] |= value.words_[word];
+
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator^=(
+    const fixed_uint256& value) NOEXCEPT
+{
+    for (size_t word = 0; word < words; ++word)
+        words_[word] ^= value.words_[word];
+
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator<<=(size_t shift) NOEXCEPT
+{
+    if (shift >= bits)
+        return *this = {};
+
+    constexpr auto word_bits = bits / words;
+    const auto offset = shift / word_bits;
+    const auto bit = shift % word_bits;
+
+    for (auto word = words; word > 0; --word)
+    {
+        const auto to = sub1(word);
+        if (to < offset)
+        {
+            words_[to] = 0;
+            continue;
+        }
+
+        const auto from = to - offset;
+        words_[to] = shift_left(words_[from], bit);
+        if (!is_zero(bit) && !is_zero(from))
+            words_[to] |= shift_right(words_[sub1(from)], word_bits - bit);
+    }
+
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator>>=(size_t shift) NOEXCEPT
+{
+    if (shift >= bits)
+        return *this = {};
+
+    constexpr auto word_bits = bits / words;
+    const auto offset = shift / word_bits;
+    const auto bit = shift % word_bits;
+
+    for (size_t to = 0; to < words; ++to)
+    {
+        const auto from = to + offset;
+        if (from >= words)
+        {
+            words_[to] = 0;
+            continue;
+        }
+
+        words_[to] = shift_right(words_[from], bit);
+        if (!is_zero(bit) && add1(from) < words)
+            words_[to] |= shift_left(words_[add1(from)], word_bits - bit);
+    }
+
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator++() NOEXCEPT
+{
+    return *this += one;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator--() NOEXCEPT
+{
+    return *this -= one;
+}
+
+constexpr fixed_uint256 fixed_uint256::operator++(int) NOEXCEPT
+{
+    const auto copy = *this;
+    ++(*this);
+    return copy;
+}
+
+constexpr fixed_uint256 fixed_uint256::operator--(int) NOEXCEPT
+{
+    const auto copy = *this;
+    --(*this);
+    return copy;
+}
+
+constexpr fixed_uint256 fixed_uint256::operator~() const NOEXCEPT
+{
+    return fixed_uint256
+    {
+        word_array{ ~words_[0], ~words_[1], ~words_[2], ~words_[3] }
+    };
+}
+
+// static
+constexpr void fixed_uint256::divide(fixed_uint256& quotient,
+    fixed_uint256& remainder, const fixed_uint256& dividend,
+    const fixed_uint256& divisor) NOEXCEPT
+{
+    // Copies allow quotient/remainder to alias dividend/divisor.
+    auto numerator = dividend;
+    auto denominator = divisor;
+    const auto width = denominator.bit_width();
+
+    if (is_zero(width))
+    {
+        quotient = {};
+        remainder = {};
+        return;
+    }
+
+    if (numerator < denominator)
+    {
+        quotient = {};
+        remainder = numerator;
+        return;
+    }
+
+    // Short division, one 128/64 bit word division per dividend word.
+    if (width <= bits / words)
+    {
+        uint64_t carry{};
+        for (auto word = words; word > 0; --word)
+            quotient.words_[sub1(word)] = divide(carry, carry,
+                numerator.words_[sub1(word)], denominator.words_[0]);
+
+        remainder = carry;
+        return;
+    }
+
+    // Shift-subtract long division (divisor exceeds one word, so the
+    // quotient is limited to 192 bits and iterations to the width difference).
+    auto shift = numerator.bit_width() - width;
+    denominator <<= shift;
+    quotient = {};
+
+    for (++shift; shift > 0; --shift)
+    {
+        quotient <<= one;
+        if (numerator >= denominator)
+        {
+            numerator -= denominator;
+            quotient.words_[0] |= one;
+        }
+
+        denominator >>= one;
+    }
+
+    remainder = numerator;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// static
+constexpr fixed_uint256::wide fixed_uint256::multiply(uint64_t left,
+    uint64_t right) NOEXCEPT
+{
+#if defined(HAVE_INT128)
+    const auto product = static_cast<unsigned __int128>(left) * right;
+    return
+    {
+        static_cast<uint64_t>(product >> 64),
+        static_cast<uint64_t>(product)
+    };
+#else
+    #if defined(HAVE_XMUL128)
+    if (!std::is_constant_evaluated())
+    {
+        uint64_t high{};
+        const auto low = _umul128(left, right, &high);
+        return { high, low };
+    }
+    #endif
+
+    constexpr uint64_t mask = max_uint32;
+    const auto ll = (left & mask) * (right & mask);
+    const auto lh = (left & mask) * (right >> 32);
+    const auto hl = (left >> 32) * (right & mask);
+    const auto hh = (left >> 32) * (right >> 32);
+    const auto middle = (ll >> 32) + (lh & mask) + (hl & mask);
+    return
+    {
+        hh + (lh >> 32) + (hl >> 32) + (middle >> 32),
+        (middle << 32) | (ll & mask)
+    };
+#endif
+}
+
+// static
+// Divides (high:low) by divisor, requires high < divisor (no overflow).
+constexpr uint64_t fixed_uint256::divide(uint64_t& remainder, uint64_t high,
+    uint64_t low, uint64_t divisor) NOEXCEPT
+{
+    BC_ASSERT(high < divisor);
+
+#if defined(HAVE_INT128)
+    const auto dividend = (static_cast<unsigned __int128>(high) << 64) | low;
+    remainder = static_cast<uint64_t>(dividend % divisor);
+    return static_cast<uint64_t>(dividend / divisor);
+#else
+    #if defined(HAVE_XMUL128)
+    if (!std::is_constant_evaluated())
+        return _udiv128(high, low, divisor, &remainder);
+    #endif
+
+    for (size_t bit = 0; bit < bits / words; ++bit)
+    {
+        const auto carry = get_left(high);
+        high = (high << 1) | (low >> 63);
+        low <<= 1;
+        if (carry || high >= divisor)
+        {
+            high -= divisor;
+            low |= 1;
+        }
+    }
+
+    remainder = high;
+    return low;
+#endif
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+// Free operators.
+// ----------------------------------------------------------------------------
+
+constexpr bool operator==(const fixed_uint256& left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left.data() == right.data();
+}
+
+constexpr std::strong_ordering operator<=>(const fixed_uint256& left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+    for (auto word = fixed_uint256::words; word > 0; --word)
+        if (const auto order = left.data()[sub1(word)] <=>
+            right.data()[sub1(word)]; order != 0)
+            return order;
+    BC_POP_WARNING()
+
+    return std::strong_ordering::equal;
+}
+
+constexpr fixed_uint256 operator+(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left += right;
+}
+
+constexpr fixed_uint256 operator-(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left -= right;
+}
+
+constexpr fixed_uint256 operator*(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left *= right;
+}
+
+constexpr fixed_uint256 operator/(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left /= right;
+}
+
+constexpr fixed_uint256 operator%(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left %= right;
+}
+
+constexpr fixed_uint256 operator&(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left &= right;
+}
+
+constexpr fixed_uint256 operator|(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left |= right;
+}
+
+constexpr fixed_uint256 operator^(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left ^= right;
+}
+
+constexpr fixed_uint256 operator<<(fixed_uint256 left, size_t shift) NOEXCEPT
+{
+    return left <<= shift;
+}
+
+constexpr fixed_uint256 operator>>(fixed_uint256 left, size_t shift) NOEXCEPT
+{
+    return left >>= shift;
+}
+
+inline std::ostream& operator<<(std::ostream& stream,
+    const fixed_uint256& value) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    stream << value.to_uintx();
+    BC_POP_WARNING()
+    return stream;
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -22,6 +22,8 @@
 #include <algorithm>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
@@ -97,10 +99,22 @@ SCONSTEXPR std::string encode_base16(const data_slice& data) NOEXCEPT
 {
     std::string out;
     out.resize(data.size() * octet_width);
-    auto digit = out.begin();
+    size_t converted{};
 
-    for (const auto byte: data)
+    // Whole blocks are vectorized at runtime, the remainder is scalar.
+    // Constant evaluation is only possible where std::string is constexpr.
+#if defined(HAVE_STRING_CONSTEXPR)
+    if (!std::is_constant_evaluated())
+#endif
     {
+        converted = encode_base16_vectorized(out.data(), data.data(),
+            data.size());
+    }
+
+    auto digit = std::next(out.begin(), converted * octet_width);
+    for (auto it = std::next(data.begin(), converted); it != data.end(); ++it)
+    {
+        const auto byte = *it;
         *digit++ = to_base16_character(shift_right(byte, to_half(byte_bits)));
         *digit++ = to_base16_character(bit_and(byte, 0x0f_u8));
     }
@@ -134,19 +148,34 @@ VCONSTEXPR bool decode_base16(data_chunk& out,
     if (!is_multiple(in.size(), octet_width))
         return false;
 
-    if (!std::all_of(in.begin(), in.end(), is_base16<char>))
-        return false;
+    // Decoded to a local, so that out is unchanged upon failure.
+    data_chunk decoded(in.size() / octet_width);
+    size_t converted{};
 
-    out.resize(in.size() / octet_width);
-    auto data = out.begin();
+    // Whole blocks are vectorized at runtime (validation is fused).
+    // Constant evaluation is only possible where std::vector is constexpr.
+#if defined(HAVE_VECTOR_CONSTEXPR)
+    if (!std::is_constant_evaluated())
+#endif
+    {
+        if (!decode_base16_vectorized(converted, decoded.data(), in.data(),
+            decoded.size()))
+            return false;
+    }
 
-    for (auto digit = in.begin(); digit != in.end();)
+    const auto start = std::next(in.begin(), converted * octet_width);
+    if (!std::all_of(start, in.end(), is_base16<char>))
+        return false;
+
+    auto data = std::next(decoded.begin(), converted);
+    for (auto digit = start; digit != in.end();)
     {
         const auto hi = *digit++;
         const auto lo = *digit++;
         *data++ = from_base16_characters(hi, lo);
     }
 
+    out = std::move(decoded);
     return true;
 }
 
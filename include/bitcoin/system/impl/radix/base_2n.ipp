@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_RADIX_BASE_2N_IPP
 #define LIBBITCOIN_SYSTEM_RADIX_BASE_2N_IPP
 
+#include <type_traits>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 
@@ -33,7 +34,8 @@ namespace system {
 // This expansion limits the exponent to e_bits, ensuring that there is only
 // one compressed representation for any given span of bits.
 template <size_t Base, size_t Precision, size_t Span>
-constexpr typename base2n<Base, Precision, Span>::span_type
+template <typename Number>
+constexpr Number
 base2n<Base, Precision, Span>::expand(small_type exponential) NOEXCEPT
 {
     const auto shift = raise(shift_right(exponential, precision));
@@ -43,7 +45,7 @@ base2n<Base, Precision, Span>::expand(small_type exponential) NOEXCEPT
     if (is_limited(shift, span))
         return 0;
 
-    span_type number{ mantissa };
+    Number number{ mantissa };
 
     shift > precision ?
         number <<= (shift - precision) :
@@ -57,14 +59,16 @@ base2n<Base, Precision, Span>::expand(small_type exponential) NOEXCEPT
 // Where more than one representation may be possible, this compression
 // produces a normal form, with minimal exponent selection.
 template <size_t Base, size_t Precision, size_t Span>
+template <typename Number>
 constexpr typename base2n<Base, Precision, Span>::small_type
-base2n<Base, Precision, Span>::compress(const span_type& number) NOEXCEPT
+base2n<Base, Precision, Span>::compress(
+    const std::type_identity_t<Number>& number) NOEXCEPT
 {
     if (is_zero(number))
         return 0;
 
     // This can only produce an exponent from [0..e_max] (zero excluded above).
-    const auto shift = raise(ceilinged_log<base>(number));
+    const auto shift = raise(digits<Number>(number));
     const auto mantissa = static_cast<small_type>
     (
         shift > precision ?
@@ -76,6 +80,20 @@ base2n<Base, Precision, Span>::compress(const span_type& number) NOEXCEPT
         precision), mantissa);
 }
 
+// private
+// Number of base digits is ceilinged_log<base>, for non-integer (fixed width)
+// numbers this is computed from the bit width, as base is a power of two.
+template <size_t Base, size_t Precision, size_t Span>
+template <typename Number>
+constexpr size_t
+base2n<Base, Precision, Span>::digits(const Number& number) NOEXCEPT
+{
+    if constexpr (is_integer<Number>)
+        return ceilinged_log<base>(number);
+    else
+        return ceilinged_divide(number.bit_width(), factor);
+}
+
 } // namespace system
 } // namespace libbitcoin
 
@@ -0,0 +1,444 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SPAN_READER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SPAN_READER_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Pointer arithmetic is bounded by available(), which is within the span.
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// constructors
+// ----------------------------------------------------------------------------
+
+INLINE span_reader::span_reader(const data_slice& source) NOEXCEPT
+  : begin_(source.begin()),
+    next_(source.begin()),
+    end_(source.end()),
+    remaining_(system::maximum<size_t>),
+    valid_(true)
+{
+}
+
+// big endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+INLINE Integer span_reader::read_big_endian() NOEXCEPT
+{
+    Integer value{};
+    auto& bytes = byte_cast(value);
+    read_bytes(std::next(bytes.data(), sizeof(Integer) - Size), Size);
+    return native_from_big_end(value);
+}
+
+INLINE uint16_t span_reader::read_2_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint16_t>();
+}
+
+INLINE uint32_t span_reader::read_3_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint32_t, 3>();
+}
+
+INLINE uint32_t span_reader::read_4_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint32_t>();
+}
+
+INLINE uint64_t span_reader::read_5_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint64_t, 5>();
+}
+
+INLINE uint64_t span_reader::read_6_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint64_t, 6>();
+}
+
+INLINE uint64_t span_reader::read_7_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint64_t, 7>();
+}
+
+INLINE uint64_t span_reader::read_8_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint64_t>();
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+INLINE Integer span_reader::read_little_endian() NOEXCEPT
+{
+    Integer value{};
+    auto& bytes = byte_cast(value);
+    read_bytes(bytes.data(), Size);
+    return native_from_little_end(value);
+}
+
+INLINE uint16_t span_reader::read_2_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint16_t>();
+}
+
+INLINE uint32_t span_reader::read_3_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint32_t, 3>();
+}
+
+INLINE uint32_t span_reader::read_4_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint32_t>();
+}
+
+INLINE uint64_t span_reader::read_5_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint64_t, 5>();
+}
+
+INLINE uint64_t span_reader::read_6_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint64_t, 6>();
+}
+
+INLINE uint64_t span_reader::read_7_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint64_t, 7>();
+}
+
+INLINE uint64_t span_reader::read_8_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint64_t>();
+}
+
+INLINE uint64_t span_reader::read_variable() NOEXCEPT
+{
+    switch (const auto value = read_byte())
+    {
+        case varint_eight_bytes:
+            return read_8_bytes_little_endian();
+        case varint_four_bytes:
+            return read_4_bytes_little_endian();
+        case varint_two_bytes:
+            return read_2_bytes_little_endian();
+        default:
+            return value;
+    }
+}
+
+INLINE size_t span_reader::read_size(size_t limit) NOEXCEPT
+{
+    const auto size = read_variable();
+
+    // This facilitates safely passing the size into a follow-on reader.
+    // Return zero allows follow-on use before testing reader state.
+    if (size > limit)
+    {
+        invalidate();
+        return zero;
+    }
+
+    return possible_narrow_cast<size_t>(size);
+}
+
+INLINE code span_reader::read_error_code() NOEXCEPT
+{
+    const auto value = read_little_endian<uint32_t>();
+    return code(static_cast<error::error_t>(value));
+}
+
+// bytes
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+INLINE data_array<Size> span_reader::read_forward() NOEXCEPT
+{
+    // Truncated bytes are populated with 0x00.
+    data_array<Size> out{};
+    read_bytes(out.data(), Size);
+    return out;
+}
+
+template <size_t Size>
+INLINE data_array<Size> span_reader::read_reverse() NOEXCEPT
+{
+    return system::reverse(read_forward<Size>());
+}
+
+INLINE std::ostream& span_reader::read(std::ostream& out) NOEXCEPT
+{
+    const auto size = available();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out.write(pointer_cast<const char>(next_),
+        possible_narrow_and_sign_cast<std::streamsize>(size));
+    BC_POP_WARNING()
+
+    skip_bytes(size);
+    return out;
+}
+
+INLINE mini_hash span_reader::read_mini_hash() NOEXCEPT
+{
+    return read_forward<mini_hash_size>();
+}
+
+INLINE short_hash span_reader::read_short_hash() NOEXCEPT
+{
+    return read_forward<short_hash_size>();
+}
+
+INLINE hash_digest span_reader::read_hash() NOEXCEPT
+{
+    return read_forward<hash_size>();
+}
+
+INLINE long_hash span_reader::read_long_hash() NOEXCEPT
+{
+    return read_forward<long_hash_size>();
+}
+
+INLINE uint8_t span_reader::peek_byte() NOEXCEPT
+{
+    if (is_zero(available()))
+    {
+        invalidate();
+        return pad();
+    }
+
+    return *next_;
+}
+
+INLINE uint8_t span_reader::read_byte() NOEXCEPT
+{
+    if (limiter(one))
+        return pad();
+
+    return *next_++;
+}
+
+INLINE data_chunk span_reader::read_bytes() NOEXCEPT
+{
+    const auto size = available();
+    const data_chunk out(next_, next_ + size);
+    skip_bytes(size);
+    return out;
+}
+
+INLINE data_chunk span_reader::read_bytes(size_t size) NOEXCEPT
+{
+    if (is_zero(size))
+        return {};
+
+    // This allows caller read an invalid reader without allocation.
+    if (!valid_)
+        return {};
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    data_chunk out(size);
+    BC_POP_WARNING()
+
+    read_bytes(out.data(), size);
+    return out;
+}
+
+INLINE void span_reader::read_bytes(uint8_t* buffer, size_t size) NOEXCEPT
+{
+    // Overflow and invalid reads are padded, not partially filled.
+    if (limiter(size))
+    {
+        std::fill_n(buffer, size, pad());
+        return;
+    }
+
+    std::copy_n(next_, size, buffer);
+    next_ += size;
+}
+
+// strings
+// ----------------------------------------------------------------------------
+
+INLINE std::string span_reader::read_string(size_t limit) NOEXCEPT
+{
+    return read_string_buffer(read_size(limit));
+}
+
+INLINE std::string span_reader::read_string_buffer(size_t size) NOEXCEPT
+{
+    // Reading past end truncates the string, but does not invalidate.
+    const auto count = std::min(size, available());
+    const auto last = std::find(next_, next_ + count, '\0');
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::string out(next_, last);
+    BC_POP_WARNING()
+
+    // Removes zero and all after, required for bitcoin string deserialization.
+    skip_bytes(count);
+    return out;
+}
+
+// context
+// ----------------------------------------------------------------------------
+
+INLINE void span_reader::skip_byte() NOEXCEPT
+{
+    skip_bytes(one);
+}
+
+INLINE void span_reader::skip_bytes(size_t size) NOEXCEPT
+{
+    if (!limiter(size))
+        next_ += size;
+}
+
+INLINE void span_reader::skip_variable() NOEXCEPT
+{
+    switch (read_byte())
+    {
+        case varint_eight_bytes:
+            skip_bytes(8);
+            return;
+        case varint_four_bytes:
+            skip_bytes(4);
+            return;
+        case varint_two_bytes:
+            skip_bytes(2);
+            return;
+        default:
+            return;
+    }
+}
+
+INLINE void span_reader::rewind_byte() NOEXCEPT
+{
+    rewind_bytes(one);
+}
+
+INLINE void span_reader::rewind_bytes(size_t size) NOEXCEPT
+{
+    if (!valid_)
+        return;
+
+    // Rewind past span start invalidates the reader.
+    if (size > static_cast<size_t>(next_ - begin_))
+    {
+        invalidate();
+        return;
+    }
+
+    // This prevents an overflow if sum exceeds max_size_t.
+    remaining_ = ceilinged_add(remaining_, size);
+    next_ -= size;
+}
+
+INLINE bool span_reader::is_exhausted() const NOEXCEPT
+{
+    // True if invalid or if no bytes remain in the span.
+    return is_zero(available());
+}
+
+INLINE size_t span_reader::get_read_position() NOEXCEPT
+{
+    // Consistent with byte_reader, position of an invalid reader is zero.
+    return valid_ ? static_cast<size_t>(next_ - begin_) : zero;
+}
+
+INLINE void span_reader::set_position(size_t absolute) NOEXCEPT
+{
+    // Clear a presumed error state following a read overflow.
+    valid_ = true;
+
+    // This allows conversion of and absolute to relative position.
+    const auto position = get_read_position();
+
+    if (absolute > position)
+        skip_bytes(absolute - position);
+    else
+        rewind_bytes(position - absolute);
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+INLINE void span_reader::set_limit(size_t size) NOEXCEPT
+{
+    remaining_ = size;
+}
+
+INLINE void span_reader::invalidate() NOEXCEPT
+{
+    valid_ = false;
+}
+
+INLINE span_reader::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+INLINE bool span_reader::operator!() const NOEXCEPT
+{
+    return !valid_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+INLINE size_t span_reader::available() const NOEXCEPT
+{
+    if (!valid_)
+        return zero;
+
+    return std::min(remaining_, static_cast<size_t>(end_ - next_));
+}
+
+INLINE bool span_reader::limiter(size_t size) NOEXCEPT
+{
+    if (size > available())
+    {
+        // Does not reset the current position or the remaining limit.
+        invalidate();
+        return true;
+    }
+
+    remaining_ -= size;
+    return false;
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
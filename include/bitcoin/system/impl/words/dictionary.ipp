@@ -42,7 +42,7 @@ static_assert(std::is_standard_layout<dictionary<1>::words>(), "performance");
 
 template<size_t Size>
 dictionary<Size>::dictionary(language identifier, const words& words) NOEXCEPT
-  : identifier_(identifier), words_(words)
+  : identifier_(identifier), words_(words), hash_(words.word)
 {
 }
 
@@ -86,15 +86,7 @@ string_list dictionary<Size>::at(const search& indexes) const NOEXCEPT
 template <size_t Size>
 int32_t dictionary<Size>::index(const std::string& word) const NOEXCEPT
 {
-    // Dictionary sort is configured on each dictionary, verified by tests.
-    // Dictionary is char* elements but using std::string (word) for compares.
-    if (words_.sorted)
-        return possible_narrow_cast<int32_t>(binary_search(words_.word, word));
-
-    // std::find returns first match, though words should be unique.
-    const auto it = std::find(words_.word.begin(), words_.word.end(), word);
-    return it == words_.word.end() ? -1 : 
-        possible_narrow_cast<int32_t>(std::distance(words_.word.begin(), it));
+    return hash_.index(word);
 }
 
 template <size_t Size>
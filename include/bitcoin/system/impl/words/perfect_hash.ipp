@@ -0,0 +1,204 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_IPP
+#define LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_IPP
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <string_view>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace words {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Constructor.
+// ----------------------------------------------------------------------------
+
+template<size_t Size>
+perfect_hash<Size>::perfect_hash(const words& words) NOEXCEPT
+  : words_(words), displacements_{}, slots_{}, perfect_(build())
+{
+}
+
+// Search.
+// ----------------------------------------------------------------------------
+
+template<size_t Size>
+int32_t perfect_hash<Size>::index(const std::string_view& word) const NOEXCEPT
+{
+    if (!perfect_)
+        return find(word);
+
+    const auto value = hash(word);
+    const auto position = slots_[slot(value, displacements_[bucket(value)])];
+
+    if (position == empty || word != words_[position])
+        return -1;
+
+    return position;
+}
+
+template<size_t Size>
+bool perfect_hash<Size>::perfect() const NOEXCEPT
+{
+    return perfect_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// Smallest power of two not less than twice the number of words.
+template<size_t Size>
+CONSTEVAL size_t perfect_hash<Size>::to_slot_count() NOEXCEPT
+{
+    size_t count = two;
+    while (count < Size * two)
+        count *= two;
+
+    return count;
+}
+
+// 64 bit finalizer (splitmix64), short words are otherwise poorly mixed.
+template<size_t Size>
+constexpr uint64_t perfect_hash<Size>::mix(uint64_t value) NOEXCEPT
+{
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+    return value ^ (value >> 31);
+}
+
+// FNV-1a, finalized.
+template<size_t Size>
+constexpr uint64_t perfect_hash<Size>::hash(
+    const std::string_view& word) NOEXCEPT
+{
+    constexpr uint64_t offset = 0xcbf29ce484222325;
+    constexpr uint64_t prime = 0x00000100000001b3;
+
+    auto value = offset;
+    for (const auto character: word)
+        value = (value ^ static_cast<uint8_t>(character)) * prime;
+
+    return mix(value);
+}
+
+template<size_t Size>
+constexpr size_t perfect_hash<Size>::bucket(uint64_t hash) NOEXCEPT
+{
+    return (hash >> 32) % bucket_count;
+}
+
+// The displacement reseeds the finalizer.
+template<size_t Size>
+constexpr size_t perfect_hash<Size>::slot(uint64_t hash,
+    uint16_t displacement) NOEXCEPT
+{
+    constexpr uint64_t golden = 0x9e3779b97f4a7c15;
+    return mix(hash + add1<uint64_t>(displacement) * golden) &
+        sub1(slot_count);
+}
+
+// Largest buckets are placed first, while the most slots remain free.
+template<size_t Size>
+bool perfect_hash<Size>::build() NOEXCEPT
+{
+    slots_.fill(empty);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::array<uint64_t, Size> hashes{};
+    std::vector<std::vector<uint16_t>> buckets(bucket_count);
+    std::vector<size_t> order(bucket_count);
+    BC_POP_WARNING()
+
+    for (size_t index = 0; index < Size; ++index)
+    {
+        hashes[index] = hash(words_[index]);
+        buckets[bucket(hashes[index])].push_back(
+            possible_narrow_cast<uint16_t>(index));
+    }
+
+    std::iota(order.begin(), order.end(), zero);
+    std::sort(order.begin(), order.end(), [&](size_t left, size_t right)
+    {
+        return buckets[left].size() > buckets[right].size();
+    });
+
+    std::vector<size_t> positions{};
+    for (const auto number: order)
+    {
+        const auto& members = buckets[number];
+        auto placed = false;
+
+        for (uint16_t displacement = 0; !placed && displacement < empty;
+            ++displacement)
+        {
+            positions.clear();
+            for (const auto member: members)
+            {
+                const auto position = slot(hashes[member], displacement);
+                if (slots_[position] != empty ||
+                    std::find(positions.begin(), positions.end(),
+                        position) != positions.end())
+                    break;
+
+                positions.push_back(position);
+            }
+
+            if (positions.size() != members.size())
+                continue;
+
+            for (size_t member = 0; member < members.size(); ++member)
+                slots_[positions[member]] = members[member];
+
+            displacements_[number] = displacement;
+            placed = true;
+        }
+
+        // Identical words hash identically and cannot be separated.
+        if (!placed)
+            return false;
+    }
+
+    return true;
+}
+
+// std::find returns first match, though words should be unique.
+template<size_t Size>
+int32_t perfect_hash<Size>::find(const std::string_view& word) const NOEXCEPT
+{
+    const auto it = std::find(words_.begin(), words_.end(), word);
+    return it == words_.end() ? -1 :
+        possible_narrow_cast<int32_t>(std::distance(words_.begin(), it));
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace words
+} // namespace system
+} // namespace libbitcoin
+
+#endif
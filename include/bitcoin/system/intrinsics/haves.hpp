@@ -62,6 +62,16 @@ BC_PUSH_WARNING(USE_CONSTEXPR_FOR_FUNCTION)
 #else
     constexpr auto with_shani = false;
 #endif
+#if defined(HAVE_AESNI)
+    constexpr auto with_aesni = true;
+#else
+    constexpr auto with_aesni = false;
+#endif
+#if defined(HAVE_VAES)
+    constexpr auto with_vaes = true;
+#else
+    constexpr auto with_vaes = false;
+#endif
 #if defined(HAVE_NEON)
     constexpr auto with_neon = true;
 #else
@@ -76,6 +86,7 @@ namespace cpu1_0
     constexpr auto leaf = 1;
     constexpr auto subleaf = 0;
     constexpr auto sse41_ecx_bit = 19;
+    constexpr auto aesni_ecx_bit = 25;
     constexpr auto xsave_ecx_bit = 27;
     constexpr auto avx_ecx_bit = 28;
 }
@@ -89,6 +100,7 @@ namespace cpu7_0
     ////constexpr auto avx512f_ebx_bit = 16;
     constexpr auto avx512bw_ebx_bit = 30;
     constexpr auto shani_ebx_bit = 29;
+    constexpr auto vaes_ecx_bit = 9;
 }
 
 namespace xcr0
@@ -161,6 +173,32 @@ inline bool try_avx2() NOEXCEPT
         return false;
 }
 
+inline bool try_aesni() NOEXCEPT
+{
+    if constexpr (with_aesni)
+    {
+        uint32_t eax{}, ebx{}, ecx{}, edx{};
+        return get_cpu(eax, ebx, ecx, edx, cpu1_0::leaf, cpu1_0::subleaf)
+            && get_bit<cpu1_0::aesni_ecx_bit>(ecx);     // AES-NI
+    }
+    else
+        return false;
+}
+
+inline bool try_vaes() NOEXCEPT
+{
+    // VAES implies AVX2 (256 bit aes operations) and AES-NI.
+    if constexpr (with_vaes && with_avx2 && with_aesni)
+    {
+        uint32_t eax{}, ebx{}, ecx{}, edx{};
+        return try_avx2() && try_aesni()
+            && get_cpu(eax, ebx, ecx, edx, cpu7_0::leaf, cpu7_0::subleaf)
+            && get_bit<cpu7_0::vaes_ecx_bit>(ecx);      // VAES
+    }
+    else
+        return false;
+}
+
 inline bool try_sse41() NOEXCEPT
 {
     if constexpr (with_sse41)
@@ -221,6 +259,18 @@ inline bool have_avx2() NOEXCEPT
     return enable;
 }
 
+inline bool have_aesni() NOEXCEPT
+{
+    static auto enable = try_aesni();
+    return enable;
+}
+
+inline bool have_vaes() NOEXCEPT
+{
+    static auto enable = try_vaes();
+    return enable;
+}
+
 inline bool have_sse41() NOEXCEPT
 {
     static auto enable = try_sse41();
@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_ARENA_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_ARENA_HPP
+
+#include <array>
+#include <variant>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+// Primary and alternate stacks have variant elements.
+typedef std::variant<bool, int64_t, chunk_xptr> stack_variant;
+
+/// Primary stack elements are bounded by the combined stack size limit, plus
+/// the largest single operation growth (op_dup3) before the limit is checked.
+constexpr size_t arena_capacity = chain::max_stack_size + 3u;
+
+/// Chunk slots are bounded by the stack size limit, overflow is tethered.
+constexpr size_t arena_chunks = chain::max_stack_size;
+
+/// Fixed capacity contiguous stack container (no allocation).
+/// Storage is uninitialized, only the populated elements are copied.
+/// Models the subset of std::vector used by machine::stack<Container>.
+class arena_stack
+{
+public:
+    typedef stack_variant value_type;
+    typedef value_type* iterator;
+    typedef const value_type* const_iterator;
+
+    /// Construct.
+    INLINE arena_stack() NOEXCEPT;
+    INLINE arena_stack(size_t count) NOEXCEPT;
+    INLINE arena_stack(const arena_stack& other) NOEXCEPT;
+    INLINE arena_stack(arena_stack&& other) NOEXCEPT;
+    INLINE arena_stack& operator=(const arena_stack& other) NOEXCEPT;
+    INLINE arena_stack& operator=(arena_stack&& other) NOEXCEPT;
+
+    /// Properties.
+    INLINE bool empty() const NOEXCEPT;
+    INLINE size_t size() const NOEXCEPT;
+
+    /// Iteration.
+    INLINE iterator begin() NOEXCEPT;
+    INLINE iterator end() NOEXCEPT;
+    INLINE const_iterator begin() const NOEXCEPT;
+    INLINE const_iterator end() const NOEXCEPT;
+
+    /// Access.
+    INLINE value_type& back() NOEXCEPT;
+    INLINE const value_type& back() const NOEXCEPT;
+    INLINE value_type& operator[](size_t index) NOEXCEPT;
+    INLINE const value_type& operator[](size_t index) const NOEXCEPT;
+
+    /// Mutation.
+    INLINE void clear() NOEXCEPT;
+    INLINE void pop_back() NOEXCEPT;
+    INLINE void push_back(const value_type& value) NOEXCEPT;
+    INLINE iterator erase(const_iterator position) NOEXCEPT;
+    template <typename... Args>
+    INLINE void emplace_back(Args&&... args) NOEXCEPT;
+
+private:
+    static_assert(std::is_trivially_copyable_v<value_type>);
+    static_assert(std::is_trivially_destructible_v<value_type>);
+
+    INLINE value_type* data() NOEXCEPT;
+    INLINE const value_type* data() const NOEXCEPT;
+
+    size_t size_;
+    alignas(value_type) std_array<uint8_t,
+        arena_capacity * sizeof(value_type)> buffer_;
+};
+
+/// Bump allocator of data_chunk slots for computed stack chunks (hashes and
+/// variant conversions). The thread's arena is reset (not reallocated) at the
+/// start of each input connect, so slot buffers are reused across inputs.
+/// Pushed data is not copied to the arena, it is referenced by the stack.
+class chunk_arena
+{
+public:
+    DELETE_COPY_MOVE(chunk_arena);
+
+    /// The calling thread's arena.
+    static INLINE chunk_arena& local() NOEXCEPT;
+
+    INLINE chunk_arena() NOEXCEPT;
+
+    /// Release all slots for reuse (invalidates all issued pointers).
+    INLINE void reset() NOEXCEPT;
+
+    /// Number of slots issued since last reset.
+    INLINE size_t size() const NOEXCEPT;
+
+    /// Copy value to the next slot, tethered to overflow when exhausted.
+    INLINE chunk_xptr assign(const data_slice& value,
+        tether<data_chunk>& overflow) NOEXCEPT;
+
+private:
+    size_t position_;
+    std_array<data_chunk, arena_chunks> slots_;
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/machine/arena.ipp>
+
+#endif
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_MACHINE_INTERPRETER_HPP
 #define LIBBITCOIN_SYSTEM_MACHINE_INTERPRETER_HPP
 
+#include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
@@ -44,29 +45,61 @@ public:
     /// Use program constructors.
     using program<Stack>::program;
 
+    /// Operation handler, bound at compile time to a specific opcode.
+    typedef error::op_error_t(interpreter::*handler)(
+        const op_iterator&) NOEXCEPT;
+
+    /// Pre-decoded operation, with handler and precomputed opcode properties.
+    struct instruction
+    {
+        handler run;
+        op_iterator op;
+        bool invalid;
+        bool oversized;
+        bool conditional;
+    };
+
+    typedef std_vector<instruction> instructions;
+
+    /// Decode script operations to an instruction stream (reusable across
+    /// programs of the same script instance, as it references script ops).
+    static instructions decode(const script& script) NOEXCEPT;
+
     /// Run a program.
     code run() NOEXCEPT;
 
+    /// Run a program from its pre-decoded script instruction stream.
+    code run(const instructions& stream) NOEXCEPT;
+
     /// Connect tx.input[#].script to tx.input[#].prevout.script.
+    /// The optional signature cache must remain in scope for the call.
     static code connect(const context& state, const transaction& tx,
-        uint32_t index) NOEXCEPT;
+        uint32_t index, signature_cache* signatures=nullptr) NOEXCEPT;
 
     /// Connect tx.input[*].script to tx.input[*].prevout.script.
+    /// The optional signature cache must remain in scope for the call.
     static code connect(const context& state, const transaction& tx,
-        const input_iterator& it) NOEXCEPT;
+        const input_iterator& it,
+        signature_cache* signatures=nullptr) NOEXCEPT;
 
 protected:
     /// Embedded script handler.
     static code connect_embedded(const context& state, const transaction& tx,
-        const input_iterator& it, interpreter& in_program) NOEXCEPT;
+        const input_iterator& it, interpreter& in_program,
+        signature_cache* signatures) NOEXCEPT;
 
     /// Witnessed script handler.
     static code connect_witness(const context& state, const transaction& tx,
-        const input_iterator& it, const script& prevout) NOEXCEPT;
+        const input_iterator& it, const script& prevout,
+        signature_cache* signatures) NOEXCEPT;
 
     /// Operation disatch.
     error::op_error_t run_op(const op_iterator& op) NOEXCEPT;
 
+    /// Operation dispatch for a compile-time opcode (handler table entry).
+    template <opcode Code>
+    error::op_error_t run_code(const op_iterator& op) NOEXCEPT;
+
     /// Operation handlers.
     inline error::op_error_t op_unevaluated(chain::opcode) const NOEXCEPT;
     inline error::op_error_t op_nop(chain::opcode) const NOEXCEPT;
@@ -154,6 +187,20 @@ protected:
     inline error::op_error_t op_check_multisig() NOEXCEPT;
     inline error::op_error_t op_check_locktime_verify() const NOEXCEPT;
     inline error::op_error_t op_check_sequence_verify() const NOEXCEPT;
+
+private:
+    typedef std_array<handler, add1<size_t>(max_uint8)> handlers;
+
+    template <size_t... Code>
+    static constexpr handlers make_handlers(
+        std::index_sequence<Code...>) NOEXCEPT;
+
+    INLINE error::op_error_t dispatch(opcode code,
+        const op_iterator& op) NOEXCEPT;
+
+    // Opcode-indexed handler table.
+    static constexpr handlers handlers_ = make_handlers(
+        std::make_index_sequence<add1<size_t>(max_uint8)>{});
 };
 
 } // namespace machine
@@ -19,9 +19,11 @@
 #ifndef LIBBITCOIN_SYSTEM_MACHINE_MACHINE_HPP
 #define LIBBITCOIN_SYSTEM_MACHINE_MACHINE_HPP
 
+#include <bitcoin/system/machine/arena.hpp>
 #include <bitcoin/system/machine/interpreter.hpp>
 #include <bitcoin/system/machine/number.hpp>
 #include <bitcoin/system/machine/program.hpp>
 #include <bitcoin/system/machine/stack.hpp>
+#include <bitcoin/system/machine/verification_cache.hpp>
 
 #endif
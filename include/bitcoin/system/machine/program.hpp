@@ -45,8 +45,10 @@ public:
     typedef std::unordered_map<uint8_t, hash_digest> hash_cache;
 
     /// Input script run (default/empty stack).
+    /// The optional signature cache must remain in scope for the run.
     inline program(const chain::transaction& transaction,
-        const input_iterator& input, uint32_t forks) NOEXCEPT;
+        const input_iterator& input, uint32_t forks,
+        signature_cache* signatures=nullptr) NOEXCEPT;
 
     /// Legacy p2sh or prevout script run (copied input stack).
     inline program(const program& other,
@@ -57,10 +59,12 @@ public:
         const chain::script::cptr& script) NOEXCEPT;
 
     /// Witness script run (witness-initialized stack).
+    /// The optional signature cache must remain in scope for the run.
     inline program(const chain::transaction& transaction,
         const input_iterator& input, const chain::script::cptr& script,
         uint32_t forks, chain::script_version version,
-        const chunk_cptrs_ptr& stack) NOEXCEPT;
+        const chunk_cptrs_ptr& stack,
+        signature_cache* signatures=nullptr) NOEXCEPT;
 
     /// Program result.
     inline bool is_true(bool clean) const NOEXCEPT;
@@ -89,6 +93,7 @@ protected:
     /// Primary stack (push).
     INLINE void push_chunk(data_chunk&& datum) NOEXCEPT;
     INLINE void push_chunk(const chunk_cptr& datum) NOEXCEPT;
+    INLINE void push_copy(const data_slice& datum) NOEXCEPT;
     INLINE void push_bool(bool value) NOEXCEPT;
     INLINE void push_signed64(int64_t value) NOEXCEPT;
     INLINE void push_length(size_t value) NOEXCEPT;
@@ -168,6 +173,10 @@ protected:
         hash_cache& cache, uint8_t& flags, const data_chunk& endorsement,
         const chain::script& sub) const NOEXCEPT;
 
+    /// Verify signature, consulting the signature cache if any.
+    inline bool verify(const data_slice& key, const hash_digest& hash,
+        const ec_signature& signature) const NOEXCEPT;
+
 private:
     using primary_stack = stack<Stack>;
 
@@ -198,6 +207,7 @@ private:
     const uint64_t value_;
     const chain::script_version version_;
     const chunk_cptrs_ptr witness_;
+    signature_cache* const signatures_;
 
     // Three stacks.
     primary_stack primary_;
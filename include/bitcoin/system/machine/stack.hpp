@@ -25,15 +25,13 @@
 #include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/machine/arena.hpp>
 
 namespace libbitcoin {
 namespace system {
 namespace machine {
 
-// Primary and alternate stacks have variant elements.
-typedef std::variant<bool, int64_t, chunk_xptr> stack_variant;
-
-// Primary stack options.
+// Primary stack options (see also arena_stack).
 typedef std::list<stack_variant> linked_stack;
 typedef std::vector<stack_variant> contiguous_stack;
 
@@ -66,6 +64,7 @@ public:
     INLINE void emplace_boolean(bool value) NOEXCEPT;
     INLINE void emplace_integer(int64_t value) NOEXCEPT;
     INLINE void emplace_chunk(const chunk_xptr& value) NOEXCEPT;
+    INLINE void emplace_copy(const data_slice& value) NOEXCEPT;
 
     /// Positional (stack cheats).
     INLINE void erase(size_t index) NOEXCEPT;
@@ -93,11 +92,16 @@ private:
 
     static constexpr auto linked_ = is_same_type<Container, linked_stack>;
     static constexpr auto vector_ = is_same_type<Container, contiguous_stack>;
-    static_assert(linked_ || vector_, "unsupported stack container");
+    static constexpr auto arena_ = is_same_type<Container, arena_stack>;
+    static constexpr auto indexed_ = vector_ || arena_;
+    static_assert(linked_ || indexed_, "unsupported stack container");
+
+    // Chunk creation, from thread arena if arena_stack (otherwise tether).
+    inline chunk_xptr make_chunk(data_chunk&& value) const NOEXCEPT;
 
     Container container_;
 
-    // Mutable as this is updated by peek_chunk.
+    // Mutable as this is updated by peek_chunk (arena overflow if arena_).
     mutable tether<data_chunk> tether_;
 };
 
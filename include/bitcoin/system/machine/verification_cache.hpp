@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_VERIFICATION_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_VERIFICATION_CACHE_HPP
+
+#include <atomic>
+#include <shared_mutex>
+#include <unordered_set>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// Bounded, thread safe set of successfully-verified input scripts.
+/// Entries are keyed on (witness tx hash, input index, active forks), salted
+/// and hashed so that entry placement cannot be predicted by a peer. Only
+/// successful verification is cached, so a hit implies script success under
+/// the same forks. Eviction is first-in-first-out once capacity is reached.
+class BC_API verification_cache
+{
+public:
+    DELETE_COPY_MOVE(verification_cache);
+
+    /// Randomly salted, capacity is the maximum number of retained entries.
+    verification_cache(size_t capacity) NOEXCEPT;
+
+    /// Explicitly salted (deterministic, for testing).
+    verification_cache(size_t capacity, const hash_digest& salt) NOEXCEPT;
+
+    /// True if verified (counts a hit or a miss).
+    bool contains(const hash_digest& witness_hash, uint32_t index,
+        uint32_t forks) const NOEXCEPT;
+
+    /// Record a successful verification (evicts oldest when full).
+    void insert(const hash_digest& witness_hash, uint32_t index,
+        uint32_t forks) NOEXCEPT;
+
+    /// Remove all entries (counters are not reset).
+    void clear() NOEXCEPT;
+
+    /// Properties.
+    size_t size() const NOEXCEPT;
+    size_t capacity() const NOEXCEPT;
+    size_t hits() const NOEXCEPT;
+    size_t misses() const NOEXCEPT;
+
+protected:
+    hash_digest key(const hash_digest& witness_hash, uint32_t index,
+        uint32_t forks) const NOEXCEPT;
+
+private:
+    struct key_hash
+    {
+        size_t operator()(const hash_digest& key) const NOEXCEPT;
+    };
+
+    // These are thread safe.
+    const size_t capacity_;
+    const hash_digest salt_;
+    mutable std::atomic<size_t> hits_{};
+    mutable std::atomic<size_t> misses_{};
+
+    // These are protected by mutex.
+    size_t next_{};
+    hashes order_{};
+    std::unordered_set<hash_digest, key_hash> keys_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
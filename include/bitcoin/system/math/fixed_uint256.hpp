@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_FIXED_UINT256_HPP
+#define LIBBITCOIN_SYSTEM_MATH_FIXED_UINT256_HPP
+
+#include <compare>
+#include <ostream>
+#include <bitcoin/system/define.hpp>
+
+#if defined(HAVE_XMUL128)
+    #include <intrin.h>
+#endif
+
+namespace libbitcoin {
+namespace system {
+
+/// Fixed width 256 bit unsigned integer, stored as four 64 bit words (lowest
+/// order first), for consensus arithmetic (proof of work and chain work).
+/// Unlike uint256_t (boost::multiprecision) this is a trivially copyable
+/// stack type, and 64 bit word multiply and divide use 128 bit intrinsics
+/// where available. All operations are constexpr and overflow wraps (modulo
+/// 2^256) as with native unsigned types. Division by zero returns zero.
+class fixed_uint256
+{
+public:
+    static constexpr size_t words = 4;
+    static constexpr size_t bits = 256;
+    typedef std_array<uint64_t, words> word_array;
+    typedef std_array<uint8_t, 32> byte_array;
+
+    /// Constructors.
+    /// -----------------------------------------------------------------------
+
+    constexpr fixed_uint256() NOEXCEPT;
+    constexpr fixed_uint256(uint64_t value) NOEXCEPT;
+    constexpr explicit fixed_uint256(const word_array& words) NOEXCEPT;
+
+    /// Little-endian bytes (e.g. hash_digest), as with to_uintx(hash).
+    constexpr explicit fixed_uint256(const byte_array& bytes) NOEXCEPT;
+
+    /// Conversion from uint256_t.
+    constexpr fixed_uint256(const uint256_t& value) NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    constexpr const word_array& data() const NOEXCEPT;
+    constexpr size_t bit_width() const NOEXCEPT;
+
+    /// Conversions.
+    /// -----------------------------------------------------------------------
+
+    /// Little-endian bytes (e.g. hash_digest), as with from_uintx(value).
+    constexpr byte_array to_bytes() const NOEXCEPT;
+    constexpr uint256_t to_uintx() const NOEXCEPT;
+
+    /// Truncating conversion to an unsigned integral type.
+    template <typename Integral, if_unsigned_integral_integer<Integral> = true>
+    constexpr explicit operator Integral() const NOEXCEPT;
+
+    /// Operators.
+    /// -----------------------------------------------------------------------
+
+    constexpr fixed_uint256& operator+=(const fixed_uint256& value) NOEXCEPT;
+    constexpr fixed_uint256& operator-=(const fixed_uint256& value) NOEXCEPT;
+    constexpr fixed_uint256& operator*=(const fixed_uint256& value) NOEXCEPT;
+    constexpr fixed_uint256& operator/=(const fixed_uint256& value) NOEXCEPT;
+    constexpr fixed_uint256& operator%=(const fixed_uint256& value) NOEXCEPT;
+    constexpr fixed_uint256& operator&=(const fixed_uint256& value) NOEXCEPT;
+    constexpr fixed_uint256& operator|=(const fixed_uint256& value) NOEXCEPT;
+    constexpr fixed_uint256& operator^=(const fixed_uint256& value) NOEXCEPT;
+    constexpr fixed_uint256& operator<<=(size_t shift) NOEXCEPT;
+    constexpr fixed_uint256& operator>>=(size_t shift) NOEXCEPT;
+    constexpr fixed_uint256& operator++() NOEXCEPT;
+    constexpr fixed_uint256& operator--() NOEXCEPT;
+    constexpr fixed_uint256 operator++(int) NOEXCEPT;
+    constexpr fixed_uint256 operator--(int) NOEXCEPT;
+    constexpr fixed_uint256 operator~() const NOEXCEPT;
+
+    /// Set quotient and remainder of dividend / divisor (zero if divisor is
+    /// zero). A single word divisor uses 128 by 64 bit word division.
+    static constexpr void divide(fixed_uint256& quotient,
+        fixed_uint256& remainder, const fixed_uint256& dividend,
+        const fixed_uint256& divisor) NOEXCEPT;
+
+private:
+    struct wide
+    {
+        uint64_t high;
+        uint64_t low;
+    };
+
+    static constexpr wide multiply(uint64_t left, uint64_t right) NOEXCEPT;
+    static constexpr uint64_t divide(uint64_t& remainder, uint64_t high,
+        uint64_t low, uint64_t divisor) NOEXCEPT;
+
+    word_array words_;
+};
+
+constexpr bool operator==(const fixed_uint256& left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr std::strong_ordering operator<=>(const fixed_uint256& left,
+    const fixed_uint256& right) NOEXCEPT;
+
+constexpr fixed_uint256 operator+(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator-(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator*(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator/(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator%(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator&(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator|(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator^(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator<<(fixed_uint256 left, size_t shift) NOEXCEPT;
+constexpr fixed_uint256 operator>>(fixed_uint256 left, size_t shift) NOEXCEPT;
+
+/// Decimal text (for diagnostics).
+inline std::ostream& operator<<(std::ostream& stream,
+    const fixed_uint256& value) NOEXCEPT;
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/math/fixed_uint256.ipp>
+
+#endif
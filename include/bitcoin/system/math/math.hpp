@@ -25,6 +25,7 @@
 #include <bitcoin/system/math/byteswap.hpp>
 #include <bitcoin/system/math/cast.hpp>
 #include <bitcoin/system/math/division.hpp>
+#include <bitcoin/system/math/fixed_uint256.hpp>
 #include <bitcoin/system/math/functional.hpp>
 #include <bitcoin/system/math/limits.hpp>
 #include <bitcoin/system/math/logarithm.hpp>
@@ -48,6 +49,7 @@
 // logarithm  -> sign, cast, overflow, division  (for ceiling/floor opts)
 // addition   -> sign, cast, overflow, limits    (for ceiling/floor opts)
 // multiply   -> sign, cast, overflow, limits    (for ceiling/floor opts)
+// fixed_uint256 -> sign, cast, bits             (for word shift/width)
 
 // sign/cast/overflow should not call any other math libs and are safe from
 // all others. bits/bytes should otherwise call only log. Otherwise only:
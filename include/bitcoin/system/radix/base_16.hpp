@@ -70,6 +70,21 @@ template <size_t Size>
 constexpr bool decode_hash(data_array<Size>& out,
     const std::string_view& in) NOEXCEPT;
 
+/// Vectorized conversion of whole blocks (AVX2/SSE4.1 if compiled and
+/// available at runtime), used by the above when not constant evaluated.
+/// ---------------------------------------------------------------------------
+
+/// Encode the leading whole blocks of size bytes to out (twice size).
+/// Returns the number of bytes encoded, the remainder is not encoded.
+BC_API size_t encode_base16_vectorized(char* out, const uint8_t* in,
+    size_t size) NOEXCEPT;
+
+/// Decode the leading whole blocks of size bytes (twice size characters).
+/// Sets converted to the number of bytes decoded, the remainder is not
+/// decoded. False if any character of the decoded blocks is not base16.
+BC_API bool decode_base16_vectorized(size_t& converted, uint8_t* out,
+    const char* in, size_t size) NOEXCEPT;
+
 /// Literal decodings of hex string, errors reflected as zero-filled data.
 /// ---------------------------------------------------------------------------
 
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_RADIX_BASE_2N_HPP
 #define LIBBITCOIN_SYSTEM_RADIX_BASE_2N_HPP
 
+#include <type_traits>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 
@@ -72,13 +73,19 @@ public:
     using span_type = unsigned_exact_type<span / byte_bits>;
     using small_type = unsigned_type<m_bytes + e_bytes>;
 
+    /// Number may be any unsigned type of at least span bits that provides
+    /// integer shift and conversion operators (e.g. fixed_uint256).
+
     /// A zero value implies an invalid (including zero) parameter.
     /// Invalid if a padding bit is set. Allows non-minimal exponent encoding.
-    static constexpr span_type expand(small_type exponential) NOEXCEPT;
+    template <typename Number = span_type>
+    static constexpr Number expand(small_type exponential) NOEXCEPT;
 
     /// (m * base^e) bit-encoded as [00eeeee][mmmmmmmm][mmmmmmmm][mmmmmmmm].
     /// Highest two bits are padded with zeros, uses minimal exponent encoding.
-    static constexpr small_type compress(const span_type& value) NOEXCEPT;
+    template <typename Number = span_type>
+    static constexpr small_type compress(
+        const std::type_identity_t<Number>& value) NOEXCEPT;
 
 protected:
     template <typename Integer>
@@ -94,6 +101,10 @@ protected:
     }
 
 private:
+    // Digits of number in base (ceilinged_log), zero for zero.
+    template <typename Number>
+    static constexpr size_t digits(const Number& number) NOEXCEPT;
+
     // Parameter constraints (these preclude mantissa padding).
     static_assert(is_byte_sized(Span));
     static_assert(is_byte_sized(base));
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_SERIAL_PROPS_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_SERIAL_PROPS_WRITER_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/serial/props.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Streaming writer for the props formats (json, info, xml).
+/// Values are written to the stream as they are provided, so a document of
+/// any size is produced without an intermediate tree (as props or json::value
+/// would require). Output is that of the equivalent props::write, except that
+/// json strings are escaped (as boost::json::serialize) and xml text is
+/// escaped. Within an object, each value must be preceded by name(). Within an
+/// array, xml elements are all named by the array element name. Stream failure
+/// is set for an out of range number or an unbalanced end_ call.
+class BC_API props_writer
+{
+public:
+    DELETE_COPY_MOVE(props_writer);
+
+    typedef props::format format;
+
+    props_writer(std::ostream& stream, format format, bool flat=true) NOEXCEPT;
+
+    /// Name of the next value within an object.
+    props_writer& name(const std::string& name) NOEXCEPT;
+
+    /// "null" value.
+    props_writer& null() NOEXCEPT;
+
+    /// "true" or "false" value.
+    props_writer& boolean(bool value) NOEXCEPT;
+
+    /// Number value, limited as props (rfc7159 interoperable range).
+    template <typename Integer, if_integer<Integer> = true>
+    props_writer& number(Integer value) NOEXCEPT
+    {
+        constexpr auto power = power2<uint64_t>(53u);
+
+        if constexpr (is_signed<Integer>)
+        {
+            if (is_negative(value))
+            {
+                const auto magnitude = add1(to_unsigned(-add1(value)));
+                return magnitude <= power ? number(true, magnitude) :
+                    invalid();
+            }
+        }
+
+        const auto magnitude = to_unsigned(value);
+        return magnitude < sub1(power) ? number(false, magnitude) : invalid();
+    }
+
+    /// string value, whitespace is not trimmed.
+    props_writer& text(const std::string& value) NOEXCEPT;
+
+    /// Object and array values, xml array elements are named by element.
+    props_writer& begin_object() NOEXCEPT;
+    props_writer& end_object() NOEXCEPT;
+    props_writer& begin_array(const std::string& element={}) NOEXCEPT;
+    props_writer& end_array() NOEXCEPT;
+
+    /// The stream is valid and all objects and arrays are ended.
+    bool is_complete() const NOEXCEPT;
+
+private:
+    struct frame
+    {
+        bool object;
+        size_t count;
+        size_t depth;
+        std::string element;
+        std::string tag;
+    };
+
+    props_writer& number(bool negative, uint64_t value) NOEXCEPT;
+    props_writer& invalid() NOEXCEPT;
+    std::string open() NOEXCEPT;
+    void close(const std::string& tag) NOEXCEPT;
+    void begin(bool object, const std::string& element) NOEXCEPT;
+    void end(bool object) NOEXCEPT;
+    void indent(size_t depth) NOEXCEPT;
+    void escape(const std::string& value) NOEXCEPT;
+
+    std::ostream& stream_;
+    const format format_;
+    const bool flat_;
+    std::string name_;
+    std::vector<frame> frames_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -21,6 +21,7 @@
 
 #include <bitcoin/system/serial/deserialize.hpp>
 #include <bitcoin/system/serial/props.hpp>
+#include <bitcoin/system/serial/props_writer.hpp>
 #include <bitcoin/system/serial/serialize.hpp>
 
 #endif
@@ -43,6 +43,7 @@
 #include <bitcoin/system/stream/streamers/interfaces/bitwriter.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bytewriter.hpp>
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
+#include <bitcoin/system/stream/streamers/span_reader.hpp>
 #include <bitcoin/system/stream/streamers.hpp>
 #include <bitcoin/system/stream/streams.hpp>
 #include <bitcoin/system/stream/stream_result.hpp>
@@ -43,6 +43,7 @@
 #include <bitcoin/system/stream/streamers/interfaces/bytewriter.hpp>
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256x2_writer.hpp>
+#include <bitcoin/system/stream/streamers/span_reader.hpp>
 
 // Stream Exceptions:
 // ============================================================================
@@ -72,6 +73,9 @@ namespace read
 
         /// A byte reader that copies data from a data_reference.
         using copy = make_streamer<copy_source<data_reference>, byte_reader>;
+
+        /// A non-virtual byte reader that reads data from a data_slice.
+        using span = span_reader;
     }
 
     namespace bits
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SPAN_READER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SPAN_READER_HPP
+
+#include <iostream>
+#include <string>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A non-virtual byte reader over a contiguous memory span.
+/// Models the byte_reader interface without virtual dispatch or istream, so
+/// that deserialization from memory (e.g. whole blocks) may be fully inlined.
+/// Reads are bounds checked, an overflow invalidates the reader and populates
+/// the read with pad (0x00). The span must remain valid while reading.
+class span_reader
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(span_reader);
+
+    /// Constructors.
+    INLINE span_reader(const data_slice& source) NOEXCEPT;
+
+    /// Read integer, size determined from parameter type.
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    INLINE Integer read_big_endian() NOEXCEPT;
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    INLINE Integer read_little_endian() NOEXCEPT;
+
+    /// Read big endian (explicit specializations of read_big_endian).
+    INLINE uint16_t read_2_bytes_big_endian() NOEXCEPT;
+    INLINE uint32_t read_3_bytes_big_endian() NOEXCEPT;
+    INLINE uint32_t read_4_bytes_big_endian() NOEXCEPT;
+    INLINE uint64_t read_5_bytes_big_endian() NOEXCEPT;
+    INLINE uint64_t read_6_bytes_big_endian() NOEXCEPT;
+    INLINE uint64_t read_7_bytes_big_endian() NOEXCEPT;
+    INLINE uint64_t read_8_bytes_big_endian() NOEXCEPT;
+
+    /// Little endian integer readers (specializations of read_little_endian).
+    INLINE uint16_t read_2_bytes_little_endian() NOEXCEPT;
+    INLINE uint32_t read_3_bytes_little_endian() NOEXCEPT;
+    INLINE uint32_t read_4_bytes_little_endian() NOEXCEPT;
+    INLINE uint64_t read_5_bytes_little_endian() NOEXCEPT;
+    INLINE uint64_t read_6_bytes_little_endian() NOEXCEPT;
+    INLINE uint64_t read_7_bytes_little_endian() NOEXCEPT;
+    INLINE uint64_t read_8_bytes_little_endian() NOEXCEPT;
+
+    /// Read Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    INLINE uint64_t read_variable() NOEXCEPT;
+
+    /// Cast read_variable to size_t, facilitates read_bytes(read_size()).
+    /// Returns zero and invalidates reader if would exceed read limit.
+    INLINE size_t read_size(size_t limit=max_size_t) NOEXCEPT;
+
+    /// Convert read_4_bytes_little_endian to an error code.
+    INLINE code read_error_code() NOEXCEPT;
+
+    /// Read size bytes into array.
+    template <size_t Size>
+    INLINE data_array<Size> read_forward() NOEXCEPT;
+    template <size_t Size>
+    INLINE data_array<Size> read_reverse() NOEXCEPT;
+
+    /// Read into stream until buffer is exhausted.
+    INLINE std::ostream& read(std::ostream& out) NOEXCEPT;
+
+    /// Read hash (explicit specializations of read_forward).
+    INLINE mini_hash read_mini_hash() NOEXCEPT;
+    INLINE short_hash read_short_hash() NOEXCEPT;
+    INLINE hash_digest read_hash() NOEXCEPT;
+    INLINE long_hash read_long_hash() NOEXCEPT;
+
+    /// Read/peek one byte (invalidates an empty reader).
+    INLINE uint8_t peek_byte() NOEXCEPT;
+    INLINE uint8_t read_byte() NOEXCEPT;
+
+    /// Read all remaining bytes.
+    INLINE data_chunk read_bytes() NOEXCEPT;
+
+    /// Read size bytes, return size is guaranteed.
+    INLINE data_chunk read_bytes(size_t size) NOEXCEPT;
+    INLINE void read_bytes(uint8_t* buffer, size_t size) NOEXCEPT;
+
+    /// Read Bitcoin length-prefixed string.
+    /// Returns empty and invalidates reader if would exceed read limit.
+    INLINE std::string read_string(size_t limit=max_size_t) NOEXCEPT;
+
+    /// Read string, truncated at size or first null.
+    /// This is only used for reading Bitcoin heading command text.
+    INLINE std::string read_string_buffer(size_t size) NOEXCEPT;
+
+    /// Advance the iterator.
+    INLINE void skip_byte() NOEXCEPT;
+    INLINE void skip_bytes(size_t size) NOEXCEPT;
+
+    /// Read one byte and advance the iterator accordingly.
+    INLINE void skip_variable() NOEXCEPT;
+
+    /// Rewind the iterator.
+    INLINE void rewind_byte() NOEXCEPT;
+    INLINE void rewind_bytes(size_t size) NOEXCEPT;
+
+    /// The reader is empty (or invalid).
+    INLINE bool is_exhausted() const NOEXCEPT;
+
+    /// Get the current absolute position.
+    INLINE size_t get_read_position() NOEXCEPT;
+
+    /// Clear invalid state and set absolute position.
+    INLINE void set_position(size_t absolute) NOEXCEPT;
+
+    /// Limit reader upper bound to current position plus size (default resets).
+    INLINE void set_limit(size_t size=max_size_t) NOEXCEPT;
+
+    /// Invalidate the reader.
+    INLINE void invalidate() NOEXCEPT;
+
+    /// The reader is valid.
+    INLINE operator bool() const NOEXCEPT;
+
+    /// The reader is invalid.
+    INLINE bool operator!() const NOEXCEPT;
+
+protected:
+    static constexpr uint8_t pad() { return 0x00; };
+
+private:
+    INLINE size_t available() const NOEXCEPT;
+    INLINE bool limiter(size_t size) NOEXCEPT;
+
+    const uint8_t* begin_;
+    const uint8_t* next_;
+    const uint8_t* end_;
+    size_t remaining_;
+    bool valid_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/span_reader.ipp>
+
+#endif
@@ -64,6 +64,15 @@ public:
         uint8_t p2kh_prefix=mainnet_p2kh,
         uint8_t p2sh_prefix=mainnet_p2sh) NOEXCEPT;
 
+    /// Encode each hash with the prefix (concurrently), in order.
+    /// Out is resized to the number of hashes.
+    static void encode(string_list& out, const short_hashes& hashes,
+        uint8_t prefix=mainnet_p2kh) NOEXCEPT;
+
+    /// Decode each address (concurrently), in order.
+    /// Out is resized to the number of addresses, invalid for any failure.
+    static void decode(list& out, const string_list& addresses) NOEXCEPT;
+
     /// Constructors.
     payment_address() NOEXCEPT;
     payment_address(payment&& decoded) NOEXCEPT;
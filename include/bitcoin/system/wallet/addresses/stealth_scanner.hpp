@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_ADDRESSES_STEALTH_SCANNER_HPP
+#define LIBBITCOIN_SYSTEM_WALLET_ADDRESSES_STEALTH_SCANNER_HPP
+
+#include <vector>
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/wallet/addresses/payment_address.hpp>
+#include <bitcoin/system/wallet/addresses/stealth_receiver.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+/// A stealth payment discovered by the scanner.
+struct BC_API stealth_match
+{
+    /// Position of the receiver in the scanner's receiver list.
+    size_t receiver;
+
+    /// Position of the transaction in the scanned batch.
+    size_t transaction;
+
+    /// Index of the paying output within the transaction.
+    uint32_t output;
+
+    /// Ephemeral public key extracted from the stealth metadata output.
+    ec_compressed ephemeral_public;
+
+    /// The derived payment address (paid by the output).
+    payment_address address;
+
+    /// The derived private key that spends the output.
+    ec_secret secret;
+};
+
+typedef std::vector<stealth_match> stealth_matches;
+
+/// Scans transaction batches for stealth payments to any of a set of
+/// receivers. Metadata outputs are matched against each receiver's prefix
+/// filter before any key derivation, and the ECDH derivations of the
+/// remaining candidates are distributed across threads.
+/// This class does not support multisignature stealth addresses.
+class BC_API stealth_scanner
+{
+public:
+    typedef std::vector<stealth_receiver> receivers;
+
+    DEFAULT_COPY_MOVE_DESTRUCT(stealth_scanner);
+
+    /// Invalid receivers are retained (for positional matching) but ignored.
+    stealth_scanner(const receivers& receivers) NOEXCEPT;
+
+    /// The receivers being scanned for.
+    const receivers& stealth_receivers() const NOEXCEPT;
+
+    /// Scan a block's transactions, matches are in transaction order.
+    stealth_matches scan(const chain::block& block) const NOEXCEPT;
+
+    /// Scan a batch of transactions, matches are in transaction order.
+    stealth_matches scan(const chain::transaction_cptrs& txs) const NOEXCEPT;
+
+private:
+    // Stealth prefix filter reduced to a 32 bit mask and masked value.
+    struct prefix_filter
+    {
+        bool valid;
+        uint32_t mask;
+        uint32_t value;
+    };
+
+    typedef std::vector<prefix_filter> prefix_filters;
+
+    static prefix_filters to_filters(const receivers& receivers) NOEXCEPT;
+
+    receivers receivers_;
+    prefix_filters filters_;
+};
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -27,6 +27,7 @@
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/wallet/keys/ec_private.hpp>
 #include <bitcoin/system/wallet/keys/ec_public.hpp>
 
@@ -110,6 +111,19 @@ class BC_API witness_address
         uint8_t& out_version, data_chunk& out_program,
         const std::string& address, bool strict=false) NOEXCEPT;
 
+    /// Encode each version_0_p2kh (short) or version_0_p2sh (long) hash with
+    /// the prefix (concurrently), in order. Out is resized to the number of
+    /// hashes, and is set to empty strings if the prefix is invalid.
+    static void encode(string_list& out, const short_hashes& hashes,
+        const std::string& prefix=mainnet) NOEXCEPT;
+    static void encode(string_list& out, const hashes& hashes,
+        const std::string& prefix=mainnet) NOEXCEPT;
+
+    /// Decode each address (concurrently), in order.
+    /// Out is resized to the number of addresses, invalid for any failure.
+    static void decode(list& out, const string_list& addresses,
+        bool strict=false) NOEXCEPT;
+
     /// Constructors.
     witness_address() NOEXCEPT;
     witness_address(const std::string& address, bool strict=false) NOEXCEPT;
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_KEYS_EC_AFFINE_HPP
+#define LIBBITCOIN_SYSTEM_WALLET_KEYS_EC_AFFINE_HPP
+
+#include <vector>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/wallet/keys/ec_point.hpp>
+#include <bitcoin/system/wallet/keys/ec_scalar.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+class ec_affine;
+typedef std::vector<ec_affine> affine_list;
+
+/// ec_affine is an ec_point held in secp256k1 internal (parsed) form.
+/// Chained operations do not parse (modular square root) or serialize the
+/// point, the compressed encoding is computed only on demand (point()).
+/// ec_affine is initialized to an invalid state.
+/// Failed operations return an invalid state.
+/// The bool operator reflects the validity state.
+/// Does not implement string serialization.
+class BC_API ec_affine
+{
+public:
+    /// The generator point.
+    static const ec_affine& generator() NOEXCEPT;
+
+    /// Multiply the generator point by scalar (faster than generator() * s).
+    static ec_affine from_scalar(const ec_scalar& scalar) NOEXCEPT;
+
+    /// Sum points with a single normalization (invalid if any is invalid).
+    static ec_affine sum(const affine_list& points) NOEXCEPT;
+
+    /// Compress points (invalid points are compressed as null).
+    static compressed_list compress(const affine_list& points) NOEXCEPT;
+
+    /// Constructors.
+    ec_affine() NOEXCEPT;
+    ec_affine(const ec_compressed& compressed) NOEXCEPT;
+    ec_affine(const ec_point& point) NOEXCEPT;
+
+    /// Operators.
+    ec_affine& operator+=(const ec_affine& point) NOEXCEPT;
+    ec_affine& operator-=(const ec_affine& point) NOEXCEPT;
+    ec_affine& operator*=(const ec_scalar& scalar) NOEXCEPT;
+    ec_affine operator-() const NOEXCEPT;
+
+    /// Cast operators.
+    operator bool() const NOEXCEPT;
+    operator ec_point() const NOEXCEPT;
+
+    /// Accessors (serialize on demand, null_ec_compressed if invalid).
+    ec_compressed point() const NOEXCEPT;
+
+private:
+    // Opaque secp256k1_pubkey storage.
+    typedef data_array<64> internal;
+
+    // This should be const, apart from the need to implement assignment.
+    internal point_;
+    bool valid_;
+};
+
+BC_API bool operator==(const ec_affine& left, const ec_affine& right) NOEXCEPT;
+BC_API bool operator!=(const ec_affine& left, const ec_affine& right) NOEXCEPT;
+BC_API ec_affine operator+(const ec_affine& left, const ec_affine& right) NOEXCEPT;
+BC_API ec_affine operator-(const ec_affine& left, const ec_affine& right) NOEXCEPT;
+BC_API ec_affine operator*(const ec_affine& left, const ec_scalar& right) NOEXCEPT;
+BC_API ec_affine operator*(const ec_scalar& left, const ec_affine& right) NOEXCEPT;
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
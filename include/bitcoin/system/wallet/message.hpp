@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_WALLET_MESSAGE_HPP
 
 #include <string>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/define.hpp>
@@ -34,6 +35,20 @@ namespace wallet {
 static constexpr size_t message_signature_size = 1 + ec_signature_size;
 typedef data_array<message_signature_size> message_signature;
 
+/// A message with the address and signature to be verified against it.
+/// The message is not owned and must remain valid through verification.
+struct BC_API signed_message
+{
+    data_slice message;
+    payment_address address;
+    message_signature signature;
+};
+
+typedef std::vector<signed_message> signed_messages;
+
+/// One bit per signed message, set if the message verifies.
+typedef std::vector<bool> message_bitmap;
+
 /// Hashes a messages in preparation for signing.
 BC_API hash_digest hash_message(const data_slice& message) NOEXCEPT;
 
@@ -71,6 +86,11 @@ BC_API bool verify_message(const data_slice& message,
     const payment_address& address,
     const message_signature& signature) NOEXCEPT;
 
+/// Verifies a batch of messages, concurrently across items.
+/// @return bitmap with each bit set if the corresponding message verifies
+/// (as with verify_message), in item order.
+BC_API message_bitmap verify_messages(const signed_messages& items) NOEXCEPT;
+
 /// Exposed primarily for independent testability.
 BC_API bool recovery_id_to_magic(uint8_t& out_magic, uint8_t recovery_id,
     bool compressed) NOEXCEPT;
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_WALLET_MNEMONICS_MNEMONIC_HPP
 
 #include <string>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -44,6 +45,7 @@ public:
 
     typedef words::mnemonic::catalog dictionary;
     typedef words::mnemonic::catalogs dictionaries;
+    typedef std::vector<string_list> word_lists;
 
     /// Supports 128 to 256 bits of entropy, in multiples of 32.
     static constexpr size_t entropy_multiple = 4;
@@ -70,6 +72,15 @@ public:
     /// Valid word counts (12, 15, 18, 21, or 24 words).
     static bool is_valid_word_count(size_t count) NOEXCEPT;
 
+    /// Decode each word list to entropy (concurrently), in order.
+    /// Entropy is empty for each list that is not a valid mnemonic.
+    static data_stack decode(const word_lists& lists,
+        language identifier=language::none) NOEXCEPT;
+
+    /// Validate each word list (concurrently), in order.
+    static std::vector<bool> validate(const word_lists& lists,
+        language identifier=language::none) NOEXCEPT;
+
     mnemonic() NOEXCEPT;
 
     /// wiki.trezor.io/recovery_seed
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_POINTS_INDEX_HPP
+#define LIBBITCOIN_SYSTEM_WALLET_POINTS_INDEX_HPP
+
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/wallet/point_value.hpp>
+#include <bitcoin/system/wallet/points_value.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+/// Unspent outputs presorted by descending value with remaining value
+/// totals, for repeated selection from the same set. Greedy and individual
+/// selection are binary searches and copies, and the search strategies
+/// prune on remaining totals, with no per-selection copy or sort.
+class BC_API points_index
+{
+public:
+    typedef points_value::selection selection;
+
+    DEFAULT_COPY_MOVE_DESTRUCT(points_index);
+
+    /// Limit on branch and bound search steps (include/exclude decisions).
+    static constexpr size_t default_tries = 100'000;
+
+    /// Number of randomized knapsack approximation passes.
+    static constexpr size_t default_iterations = 1'000;
+
+    /// Index a set of unspent outputs.
+    points_index(const points_value& unspent) NOEXCEPT;
+    points_index(point_value::list&& unspent) NOEXCEPT;
+
+    /// Select outpoints for a spend (see points_value::selection).
+    void select(points_value& out, uint64_t minimum_value,
+        selection option=selection::greedy) const NOEXCEPT;
+
+    /// Least change set, by search of up to the given number of steps.
+    void branch_and_bound(points_value& out, uint64_t minimum_value,
+        size_t tries=default_tries) const NOEXCEPT;
+
+    /// Best single or approximated set, over the given number of passes.
+    void knapsack(points_value& out, uint64_t minimum_value,
+        size_t iterations=default_iterations) const NOEXCEPT;
+
+    /// The indexed points in descending order by value.
+    const point_value::list& points() const NOEXCEPT;
+
+    /// Total value of the indexed points (overflow returns max_uint64).
+    uint64_t value() const NOEXCEPT;
+
+private:
+    typedef std::vector<uint64_t> totals;
+    typedef std::vector<size_t> positions;
+
+    static point_value::list& sort(point_value::list& points) NOEXCEPT;
+    static totals remaining(const point_value::list& points) NOEXCEPT;
+
+    // Count of leading points individually sufficient for the minimum.
+    size_t sufficient(uint64_t minimum_value) const NOEXCEPT;
+
+    // Value of the points at and after position (overflow returns max).
+    uint64_t remaining(size_t position) const NOEXCEPT;
+
+    void greedy(points_value& out, uint64_t minimum_value) const NOEXCEPT;
+    void individual(points_value& out, uint64_t minimum_value) const NOEXCEPT;
+    void assign(points_value& out,
+        const positions& selected) const NOEXCEPT;
+
+    point_value::list points_;
+    totals remaining_;
+};
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
+
+#endif
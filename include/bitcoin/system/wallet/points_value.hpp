@@ -39,10 +39,21 @@ public:
 
         /// A set of individually sufficient unspent outputs. Each individual
         /// member of the set is sufficient. Return ascending order by value.
-        individual
+        individual,
+
+        /// The sufficient set of unspent outputs of least total value (least
+        /// change), by bounded depth-first search. Falls back to greedy if
+        /// the search limit is reached without finding a set.
+        branch_and_bound,
+
+        /// The better of the smallest single sufficient unspent output and
+        /// the least sufficient set of smaller outputs found by randomized
+        /// approximation (subset sum).
+        knapsack
     };
 
     /// Select outpoints for a spend from a list of unspent outputs.
+    /// Use points_index to select repeatedly from the same unspent outputs.
     static void select(points_value& out, const points_value& unspent,
         uint64_t minimum_value, selection option=selection::greedy) NOEXCEPT;
 
@@ -25,12 +25,14 @@
 #include <bitcoin/system/wallet/addresses/qr_code.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_address.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_receiver.hpp>
+#include <bitcoin/system/wallet/addresses/stealth_scanner.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_sender.hpp>
 #include <bitcoin/system/wallet/addresses/tiff.hpp>
 #include <bitcoin/system/wallet/addresses/uri.hpp>
 #include <bitcoin/system/wallet/addresses/uri_reader.hpp>
 #include <bitcoin/system/wallet/addresses/witness_address.hpp>
 #include <bitcoin/system/wallet/context.hpp>
+#include <bitcoin/system/wallet/keys/ec_affine.hpp>
 #include <bitcoin/system/wallet/keys/ec_point.hpp>
 #include <bitcoin/system/wallet/keys/ec_private.hpp>
 #include <bitcoin/system/wallet/keys/ec_public.hpp>
@@ -49,6 +51,7 @@
 #include <bitcoin/system/wallet/mnemonics/mnemonic.hpp>
 #include <bitcoin/system/wallet/neutrino_filter.hpp>
 #include <bitcoin/system/wallet/point_value.hpp>
+#include <bitcoin/system/wallet/points_index.hpp>
 #include <bitcoin/system/wallet/points_value.hpp>
 
 #endif
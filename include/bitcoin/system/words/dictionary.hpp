@@ -26,14 +26,15 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/words/language.hpp>
+#include <bitcoin/system/words/perfect_hash.hpp>
 
 namespace libbitcoin {
 namespace system {
 namespace words {
 
 // Search container for a dictionary of lexically-sorted words.
-// POD dictionary wrapper with O(n) search and O(1) index.
-// Search order is guaranteed, always returns first match.
+// POD dictionary wrapper with O(1) search and O(1) index.
+// Search is by perfect hash, built once upon construction.
 template<size_t Size>
 class dictionary final
 {
@@ -84,6 +85,9 @@ private:
     // this wrapper dictionary object is created for each word list, for
     // each dictionaries object constructed by various mnemonic classes.
     const words& words_;
+
+    // Index over the held words, independent of sort.
+    const perfect_hash<Size> hash_;
 };
 
 } // namespace words
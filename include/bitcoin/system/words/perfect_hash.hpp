@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_HPP
+#define LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_HPP
+
+#include <array>
+#include <string_view>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace words {
+
+/// Perfect hash index over a fixed list of distinct words, by hash and
+/// displace. Words are hashed into buckets, and each bucket is assigned a
+/// displacement that places all of its words into distinct unused slots.
+/// Lookup is one hash, one displacement and at most one word comparison,
+/// independent of word order. If the index cannot be built (duplicate words)
+/// lookup falls back to linear search, returning the first match.
+template<size_t Size>
+class perfect_hash final
+{
+public:
+    typedef std::array<const char*, Size> words;
+    static_assert(Size < max_uint16);
+
+    /// Build the index over the words, which are held by reference.
+    perfect_hash(const words& words) NOEXCEPT;
+
+    /// -1 if word is not found.
+    int32_t index(const std::string_view& word) const NOEXCEPT;
+
+    /// False if the index fell back to linear search.
+    bool perfect() const NOEXCEPT;
+
+private:
+    static CONSTEVAL size_t to_slot_count() NOEXCEPT;
+
+    // Average of four words per bucket, and slots at load of at most half.
+    static constexpr auto bucket_count = std::max(one, Size / 4u);
+    static constexpr auto slot_count = to_slot_count();
+    static constexpr auto empty = max_uint16;
+
+    typedef std::array<uint16_t, bucket_count> displacements;
+    typedef std::array<uint16_t, slot_count> slots;
+
+    static constexpr uint64_t mix(uint64_t value) NOEXCEPT;
+    static constexpr uint64_t hash(const std::string_view& word) NOEXCEPT;
+    static constexpr size_t bucket(uint64_t hash) NOEXCEPT;
+    static constexpr size_t slot(uint64_t hash, uint16_t displacement) NOEXCEPT;
+
+    bool build() NOEXCEPT;
+    int32_t find(const std::string_view& word) const NOEXCEPT;
+
+    const words& words_;
+    displacements displacements_;
+    slots slots_;
+    bool perfect_;
+};
+
+} // namespace words
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/words/perfect_hash.ipp>
+
+#endif
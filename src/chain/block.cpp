@@ -73,9 +73,7 @@ block::block(const chain::header::cptr& header,
 }
 
 block::block(const data_slice& data, bool witness) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : block(stream::in::copy(data), witness)
-    BC_POP_WARNING()
+  : block(span_reader(data), witness)
 {
 }
 
@@ -99,6 +97,16 @@ block::block(reader& source, bool witness) NOEXCEPT
 {
 }
 
+block::block(span_reader&& source, bool witness) NOEXCEPT
+  : block(from_data(source, witness))
+{
+}
+
+block::block(span_reader& source, bool witness) NOEXCEPT
+  : block(from_data(source, witness))
+{
+}
+
 // protected
 block::block(const chain::header::cptr& header,
     const chain::transactions_cptr& txs, bool valid) NOEXCEPT
@@ -124,9 +132,10 @@ bool block::operator!=(const block& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-block block::from_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+block block::from_data(Source& source, bool witness) NOEXCEPT
 {
-    const auto read_transactions = [witness](reader& source) NOEXCEPT
+    const auto read_transactions = [witness](auto& source) NOEXCEPT
     {
         auto txs = to_shared<transaction_cptrs>();
         txs->reserve(source.read_size(max_block_size));
@@ -239,7 +248,9 @@ hashes block::transaction_hashes(bool witness) const NOEXCEPT
         return tx->hash(witness);
     };
 
-    std::transform(txs_->begin(), txs_->end(), out.begin(), hash);
+    std_transform(bc::par_unseq, txs_->begin(), txs_->end(), out.begin(),
+        hash);
+
     return out;
 }
 
@@ -601,6 +612,23 @@ void block::populate() const NOEXCEPT
     BC_POP_WARNING()
 }
 
+void block::populate_hashes(bool witness) const NOEXCEPT
+{
+    const auto set = [witness](const transaction::cptr& tx) NOEXCEPT
+    {
+        if (!tx->is_hashed(false))
+            tx->set_hash(tx->hash(false));
+
+        // Otherwise witness hash is tx hash (bip141) or null_hash (coinbase).
+        if (witness && tx->is_segregated() && !tx->is_coinbase() &&
+            !tx->is_hashed(true))
+            tx->set_witness_hash(tx->hash(true));
+    };
+
+    // Each tx is exclusive to one thread, caches are set on const objects.
+    std_for_each(bc::par_unseq, txs_->begin(), txs_->end(), set);
+}
+
 // Delegated.
 // ----------------------------------------------------------------------------
 
@@ -642,13 +670,14 @@ code block::accept_transactions(const context& ctx) const NOEXCEPT
 }
 
 // Do NOT invoke on coinbase.
-code block::connect_transactions(const context& ctx) const NOEXCEPT
+code block::connect_transactions(const context& ctx,
+    signature_cache* signatures) const NOEXCEPT
 {
     code ec;
 
     if (!is_empty())
         for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
-            if ((ec = (*tx)->connect(ctx)))
+            if ((ec = (*tx)->connect(ctx, signatures)))
                 return ec;
 
     return error::block_success;
@@ -740,9 +769,10 @@ code block::confirm(const context& ctx) const NOEXCEPT
     return confirm_transactions(ctx);
 }
 
-code block::connect(const context& ctx) const NOEXCEPT
+code block::connect(const context& ctx,
+    signature_cache* signatures) const NOEXCEPT
 {
-    return connect_transactions(ctx);
+    return connect_transactions(ctx, signatures);
 }
 
 // JSON value convertors.
@@ -794,6 +824,20 @@ void tag_invoke(json::value_from_tag tag, json::value& value,
 BC_POP_WARNING()
 BC_POP_WARNING()
 
+// props
+// ----------------------------------------------------------------------------
+
+void to_props(props_writer& writer, const block& block) NOEXCEPT
+{
+    writer.begin_object().name("header");
+    to_props(writer, block.header());
+    writer.name("transactions").begin_array("transaction");
+    for (const auto& tx: *block.transactions_ptr())
+        to_props(writer, *tx);
+
+    writer.end_array().end_object();
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
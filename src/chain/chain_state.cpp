@@ -339,11 +339,12 @@ uint32_t chain_state::retarget_timespan(const data& values,
     return limit(timespan, minimum_timespan, maximum_timespan);
 }
 
-constexpr bool patch_timewarp(uint32_t forks, const uint256_t& limit,
-    const uint256_t& target) NOEXCEPT
+constexpr bool patch_timewarp(uint32_t forks, const fixed_uint256& limit,
+    const fixed_uint256& target) NOEXCEPT
 {
+    // Equivalent to floored_log2 comparison, as target and limit are nonzero.
     return script::is_enabled(forks, forks::retarget_overflow_patch) &&
-        floored_log2(target) >= floored_log2(limit);
+        target.bit_width() >= limit.bit_width();
 }
 
 uint32_t chain_state::work_required_retarget(const data& values, uint32_t forks,
@@ -354,7 +355,7 @@ uint32_t chain_state::work_required_retarget(const data& values, uint32_t forks,
     auto target = compact::expand(bits_high(values));
 
     // Conditionally implement retarget overflow patch (e.g. Litecoin).
-    const auto timewarp = to_int(patch_timewarp(forks, limit, target));
+    const auto timewarp = to_int<size_t>(patch_timewarp(forks, limit, target));
 
     target >>= timewarp;
     target *= retarget_timespan(values, minimum_timespan, maximum_timespan);
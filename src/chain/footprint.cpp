@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/footprint.hpp>
+
+#include <memory>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/operation.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/packed_transaction.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Reference counts (use and weak) of a shared_ptr control block.
+constexpr auto control_block = two * sizeof(size_t);
+
+template <typename Vector>
+constexpr size_t capacity(const Vector& vector) NOEXCEPT
+{
+    return vector.capacity() * sizeof(typename Vector::value_type);
+}
+
+static size_t footprint(const data_chunk& chunk) NOEXCEPT
+{
+    return sizeof(data_chunk) + capacity(chunk);
+}
+
+template <typename Shared>
+constexpr size_t shared(const Shared& pointer) NOEXCEPT
+{
+    return pointer ? control_block + footprint(*pointer) : zero;
+}
+
+size_t footprint(const operation& operation) NOEXCEPT
+{
+    // Non-push opcodes share a static empty chunk.
+    const auto& data = operation.data_ptr();
+    return sizeof(chain::operation) +
+        (data && !data->empty() ? shared(data) : zero);
+}
+
+size_t footprint(const script& script) NOEXCEPT
+{
+    // Operation objects are contained in vector capacity.
+    auto size = sizeof(chain::script) + capacity(script.ops());
+    for (const auto& operation: script.ops())
+        size += footprint(operation) - sizeof(chain::operation);
+
+    return size;
+}
+
+size_t footprint(const witness& witness) NOEXCEPT
+{
+    auto size = sizeof(chain::witness) + capacity(witness.stack());
+    for (const auto& element: witness.stack())
+        size += shared(element);
+
+    return size;
+}
+
+size_t footprint(const point&) NOEXCEPT
+{
+    return sizeof(chain::point);
+}
+
+size_t footprint(const input& input) NOEXCEPT
+{
+    return sizeof(chain::input) +
+        shared(input.point_ptr()) +
+        shared(input.script_ptr()) +
+        shared(input.witness_ptr());
+}
+
+size_t footprint(const output& output) NOEXCEPT
+{
+    return sizeof(chain::output) + shared(output.script_ptr());
+}
+
+size_t footprint(const transaction& tx) NOEXCEPT
+{
+    auto size = sizeof(transaction) +
+        control_block + capacity(*tx.inputs_ptr()) +
+        control_block + capacity(*tx.outputs_ptr());
+
+    for (const auto& input: *tx.inputs_ptr())
+        size += shared(input);
+
+    for (const auto& output: *tx.outputs_ptr())
+        size += shared(output);
+
+    return size;
+}
+
+size_t footprint(const header&) NOEXCEPT
+{
+    return sizeof(header);
+}
+
+size_t footprint(const block& block) NOEXCEPT
+{
+    const auto& txs = *block.transactions_ptr();
+    auto size = sizeof(chain::block) + shared(block.header_ptr()) +
+        control_block + capacity(txs);
+
+    for (const auto& tx: txs)
+        size += shared(tx);
+
+    return size;
+}
+
+size_t footprint(const packed_transaction& tx) NOEXCEPT
+{
+    // The buffer is allocated to size.
+    return sizeof(packed_transaction) + tx.buffer_size();
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -60,9 +60,7 @@ header::header(uint32_t version, const hash_digest& previous_block_hash,
 }
 
 header::header(const data_slice& data) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : header(stream::in::copy(data))
-    BC_POP_WARNING()
+  : header(span_reader(data))
 {
 }
 
@@ -86,6 +84,16 @@ header::header(reader& source) NOEXCEPT
 {
 }
 
+header::header(span_reader&& source) NOEXCEPT
+  : header(from_data(source))
+{
+}
+
+header::header(span_reader& source) NOEXCEPT
+  : header(from_data(source))
+{
+}
+
 // protected
 header::header(uint32_t version, hash_digest&& previous_block_hash,
     hash_digest&& merkle_root, uint32_t timestamp, uint32_t bits,
@@ -136,7 +144,8 @@ bool header::operator!=(const header& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-header header::from_data(reader& source) NOEXCEPT
+template <typename Source>
+header header::from_data(Source& source) NOEXCEPT
 {
     return
     {
@@ -239,7 +248,7 @@ hash_digest header::hash() const NOEXCEPT
 }
 
 // static/private
-uint256_t header::difficulty(uint32_t bits) NOEXCEPT
+fixed_uint256 header::difficulty(uint32_t bits) NOEXCEPT
 {
     auto target = compact::expand(bits);
 
@@ -263,7 +272,7 @@ uint256_t header::difficulty(uint32_t bits) NOEXCEPT
 }
 
 // computed
-uint256_t header::difficulty() const NOEXCEPT
+fixed_uint256 header::difficulty() const NOEXCEPT
 {
     // Returns zero if bits_ mantissa is less than one or bits_ is overflowed.
     return difficulty(bits_);
@@ -290,7 +299,7 @@ bool header::is_invalid_proof_of_work(uint32_t proof_of_work_limit,
         return true;
 
     // Conditionally use scrypt proof of work (e.g. Litecoin).
-    return to_uintx(scrypt ? scrypt_hash(to_data()) : hash()) > target;
+    return fixed_uint256{ scrypt ? scrypt_hash(to_data()) : hash() } > target;
 }
 
 // ****************************************************************************
@@ -397,6 +406,21 @@ void tag_invoke(json::value_from_tag tag, json::value& value,
 BC_POP_WARNING()
 BC_POP_WARNING()
 
+// props
+// ----------------------------------------------------------------------------
+
+void to_props(props_writer& writer, const header& header) NOEXCEPT
+{
+    writer.begin_object()
+        .name("version").number(header.version())
+        .name("previous").text(encode_hash(header.previous_block_hash()))
+        .name("merkle_root").text(encode_hash(header.merkle_root()))
+        .name("timestamp").number(header.timestamp())
+        .name("bits").number(header.bits())
+        .name("nonce").number(header.nonce())
+        .end_object();
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
@@ -111,9 +111,7 @@ input::input(const chain::point::cptr& point, const chain::script::cptr& script,
 }
 
 input::input(const data_slice& data) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : input(stream::in::copy(data))
-    BC_POP_WARNING()
+  : input(span_reader(data))
 {
 }
 
@@ -137,6 +135,16 @@ input::input(reader& source) NOEXCEPT
 {
 }
 
+input::input(span_reader&& source) NOEXCEPT
+  : input(from_data(source))
+{
+}
+
+input::input(span_reader& source) NOEXCEPT
+  : input(from_data(source))
+{
+}
+
 // protected
 input::input(const chain::point::cptr& point, const chain::script::cptr& script,
     const chain::witness::cptr& witness, uint32_t sequence, bool valid) NOEXCEPT
@@ -168,7 +176,8 @@ bool input::operator!=(const input& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-input input::from_data(reader& source) NOEXCEPT
+template <typename Source>
+input input::from_data(Source& source) NOEXCEPT
 {
     // Witness is deserialized by transaction.
     return
@@ -432,6 +441,20 @@ void tag_invoke(json::value_from_tag tag, json::value& value,
 BC_POP_WARNING()
 BC_POP_WARNING()
 
+// props
+// ----------------------------------------------------------------------------
+
+void to_props(props_writer& writer, const input& input) NOEXCEPT
+{
+    writer.begin_object().name("point");
+    to_props(writer, input.point());
+    writer.name("script");
+    to_props(writer, input.script());
+    writer.name("witness");
+    to_props(writer, input.witness());
+    writer.name("sequence").number(input.sequence()).end_object();
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
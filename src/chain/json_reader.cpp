@@ -0,0 +1,551 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/json_reader.hpp>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/radix/radix.hpp>
+
+// Template implementation of json::basic_parser (include in one unit only).
+#include <boost/json/basic_parser_impl.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+namespace json = boost::json;
+
+// Allocation failure aborts.
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Handler for json::basic_parser, which invokes these as the text is parsed.
+// Member values are collected as the object's members are parsed, and the
+// chain object is constructed (and appended to its parent) at object end.
+class json_builder
+{
+public:
+    static constexpr size_t max_object_size = max_size_t;
+    static constexpr size_t max_array_size = max_size_t;
+    static constexpr size_t max_key_size = max_size_t;
+    static constexpr size_t max_string_size = max_size_t;
+
+    json_builder(transaction* tx, transactions* txs, block* block) NOEXCEPT
+      : tx_out_(tx), txs_out_(txs), block_out_(block)
+    {
+    }
+
+    bool complete() const NOEXCEPT
+    {
+        return complete_;
+    }
+
+    // Document.
+    // ------------------------------------------------------------------------
+
+    bool on_document_begin(json::error_code&) NOEXCEPT
+    {
+        return true;
+    }
+
+    bool on_document_end(json::error_code& ec) NOEXCEPT
+    {
+        return complete_ || fail(ec);
+    }
+
+    // Objects and arrays.
+    // ------------------------------------------------------------------------
+
+    bool on_object_begin(json::error_code& ec) NOEXCEPT
+    {
+        return begin(true, ec);
+    }
+
+    bool on_object_end(size_t, json::error_code& ec) NOEXCEPT
+    {
+        if (frames_.back().found != required(frames_.back().type))
+            return fail(ec);
+
+        if (!build(frames_.back().type))
+            return fail(ec);
+
+        return end();
+    }
+
+    bool on_array_begin(json::error_code& ec) NOEXCEPT
+    {
+        return begin(false, ec);
+    }
+
+    bool on_array_end(size_t, json::error_code&) NOEXCEPT
+    {
+        return end();
+    }
+
+    // Keys.
+    // ------------------------------------------------------------------------
+
+    bool on_key_part(json::string_view part, size_t,
+        json::error_code&) NOEXCEPT
+    {
+        part_.append(part.data(), part.size());
+        return true;
+    }
+
+    bool on_key(json::string_view last, size_t, json::error_code& ec) NOEXCEPT
+    {
+        key_ = to_field(frames_.back().type, take(last));
+        part_.clear();
+
+        // Unknown and duplicated members are not allowed.
+        const auto flag = to_flag(key_);
+        if (key_ == field::none || !is_zero(frames_.back().found & flag))
+            return fail(ec);
+
+        frames_.back().found |= flag;
+        return true;
+    }
+
+    // Values.
+    // ------------------------------------------------------------------------
+
+    bool on_string_part(json::string_view part, size_t,
+        json::error_code&) NOEXCEPT
+    {
+        part_.append(part.data(), part.size());
+        return true;
+    }
+
+    bool on_string(json::string_view last, size_t,
+        json::error_code& ec) NOEXCEPT
+    {
+        const auto result = text(take(last));
+        part_.clear();
+        key_ = field::none;
+        return result || fail(ec);
+    }
+
+    bool on_number_part(json::string_view, json::error_code&) NOEXCEPT
+    {
+        return true;
+    }
+
+    bool on_int64(int64_t value, json::string_view,
+        json::error_code& ec) NOEXCEPT
+    {
+        return (!is_negative(value) && number(to_unsigned(value))) ||
+            fail(ec);
+    }
+
+    bool on_uint64(uint64_t value, json::string_view,
+        json::error_code& ec) NOEXCEPT
+    {
+        return number(value) || fail(ec);
+    }
+
+    bool on_double(double, json::string_view, json::error_code& ec) NOEXCEPT
+    {
+        return fail(ec);
+    }
+
+    bool on_bool(bool, json::error_code& ec) NOEXCEPT
+    {
+        return fail(ec);
+    }
+
+    bool on_null(json::error_code& ec) NOEXCEPT
+    {
+        return fail(ec);
+    }
+
+    bool on_comment_part(json::string_view, json::error_code&) NOEXCEPT
+    {
+        return true;
+    }
+
+    bool on_comment(json::string_view, json::error_code&) NOEXCEPT
+    {
+        return true;
+    }
+
+private:
+    enum class node : uint8_t
+    {
+        none,
+        block,
+        header,
+        transactions,
+        transaction,
+        inputs,
+        input,
+        point,
+        outputs,
+        output
+    };
+
+    enum class field : uint8_t
+    {
+        none,
+        version,
+        previous,
+        merkle_root,
+        timestamp,
+        bits,
+        nonce,
+        header,
+        transactions,
+        inputs,
+        outputs,
+        locktime,
+        point,
+        script,
+        witness,
+        sequence,
+        value,
+        hash,
+        index
+    };
+
+    struct member
+    {
+        node parent;
+        std::string_view name;
+        field key;
+    };
+
+    struct frame
+    {
+        node type;
+        uint32_t found;
+    };
+
+    static constexpr std_array<member, 20> members
+    {
+        {
+            { node::block, "header", field::header },
+            { node::block, "transactions", field::transactions },
+            { node::header, "version", field::version },
+            { node::header, "previous", field::previous },
+            { node::header, "merkle_root", field::merkle_root },
+            { node::header, "timestamp", field::timestamp },
+            { node::header, "bits", field::bits },
+            { node::header, "nonce", field::nonce },
+            { node::transaction, "version", field::version },
+            { node::transaction, "inputs", field::inputs },
+            { node::transaction, "outputs", field::outputs },
+            { node::transaction, "locktime", field::locktime },
+            { node::input, "point", field::point },
+            { node::input, "script", field::script },
+            { node::input, "witness", field::witness },
+            { node::input, "sequence", field::sequence },
+            { node::point, "hash", field::hash },
+            { node::point, "index", field::index },
+            { node::output, "value", field::value },
+            { node::output, "script", field::script }
+        }
+    };
+
+    static constexpr uint32_t to_flag(field key) NOEXCEPT
+    {
+        return power2<uint32_t>(static_cast<size_t>(key));
+    }
+
+    static constexpr field to_field(node parent,
+        const std::string_view& name) NOEXCEPT
+    {
+        for (const auto& member: members)
+            if (member.parent == parent && member.name == name)
+                return member.key;
+
+        return field::none;
+    }
+
+    static constexpr uint32_t required(node type) NOEXCEPT
+    {
+        uint32_t flags{};
+        for (const auto& member: members)
+            if (member.parent == type)
+                flags |= to_flag(member.key);
+
+        return flags;
+    }
+
+    static bool fail(json::error_code& ec) NOEXCEPT
+    {
+        ec = json::error::syntax;
+        return false;
+    }
+
+    // Zero copy unless the value was delivered in parts.
+    std::string_view take(const json::string_view& last) NOEXCEPT
+    {
+        if (part_.empty())
+            return { last.data(), last.size() };
+
+        part_.append(last.data(), last.size());
+        return part_;
+    }
+
+    // The node that the next object or array value is (none if unexpected).
+    node nested(bool object) const NOEXCEPT
+    {
+        if (frames_.empty())
+        {
+            if (complete_)
+                return node::none;
+
+            if (object)
+                return tx_out_ != nullptr ? node::transaction :
+                    (block_out_ != nullptr ? node::block : node::none);
+
+            return txs_out_ != nullptr ? node::transactions : node::none;
+        }
+
+        switch (frames_.back().type)
+        {
+            case node::block:
+                return key_ == field::header && object ? node::header :
+                    (key_ == field::transactions && !object ?
+                        node::transactions : node::none);
+            case node::transaction:
+                return key_ == field::inputs && !object ? node::inputs :
+                    (key_ == field::outputs && !object ?
+                        node::outputs : node::none);
+            case node::input:
+                return key_ == field::point && object ? node::point :
+                    node::none;
+            case node::transactions:
+                return object ? node::transaction : node::none;
+            case node::inputs:
+                return object ? node::input : node::none;
+            case node::outputs:
+                return object ? node::output : node::none;
+            default:
+                return node::none;
+        }
+    }
+
+    bool begin(bool object, json::error_code& ec) NOEXCEPT
+    {
+        const auto type = nested(object);
+        if (type == node::none)
+            return fail(ec);
+
+        frames_.push_back({ type, 0 });
+        key_ = field::none;
+        return true;
+    }
+
+    bool end() NOEXCEPT
+    {
+        frames_.pop_back();
+        complete_ = frames_.empty();
+        key_ = field::none;
+        return true;
+    }
+
+    bool text(const std::string_view& value) NOEXCEPT
+    {
+        switch (key_)
+        {
+            case field::hash:
+                return decode_hash(hash_, value);
+            case field::previous:
+                return decode_hash(previous_, value);
+            case field::merkle_root:
+                return decode_hash(merkle_root_, value);
+            case field::script:
+                script_ = chain::script{ std::string{ value } };
+                return script_.is_valid();
+            case field::witness:
+                witness_ = chain::witness{ std::string{ value } };
+                return witness_.is_valid();
+            default:
+                return false;
+        }
+    }
+
+    bool number(uint64_t value) NOEXCEPT
+    {
+        if (key_ == field::value)
+        {
+            value_ = value;
+            key_ = field::none;
+            return true;
+        }
+
+        if (value > max_uint32)
+            return false;
+
+        const auto word = narrow_cast<uint32_t>(value);
+        switch (key_)
+        {
+            case field::version: version_ = word; break;
+            case field::timestamp: timestamp_ = word; break;
+            case field::bits: bits_ = word; break;
+            case field::nonce: nonce_ = word; break;
+            case field::locktime: locktime_ = word; break;
+            case field::sequence: sequence_ = word; break;
+            case field::index: index_ = word; break;
+            default: return false;
+        }
+
+        key_ = field::none;
+        return true;
+    }
+
+    // Values are moved into the new object, all are reset by the next.
+    bool build(node type) NOEXCEPT
+    {
+        switch (type)
+        {
+            case node::point:
+                return true;
+            case node::input:
+            {
+                inputs_.push_back(to_shared<chain::input>(
+                    chain::point{ std::move(hash_), index_ },
+                    std::move(script_), std::move(witness_), sequence_));
+                return true;
+            }
+            case node::output:
+            {
+                outputs_.push_back(to_shared<chain::output>(value_,
+                    std::move(script_)));
+                return true;
+            }
+            case node::header:
+            {
+                header_ = to_shared<chain::header>(version_,
+                    std::move(previous_), std::move(merkle_root_), timestamp_,
+                    bits_, nonce_);
+                return true;
+            }
+            case node::transaction:
+            {
+                chain::transaction tx
+                {
+                    version_,
+                    to_shared(std::move(inputs_)),
+                    to_shared(std::move(outputs_)),
+                    locktime_
+                };
+
+                inputs_.clear();
+                outputs_.clear();
+
+                // Root transaction, batch element, or block transaction.
+                if (tx_out_ != nullptr)
+                    *tx_out_ = std::move(tx);
+                else if (txs_out_ != nullptr)
+                    txs_out_->push_back(std::move(tx));
+                else
+                    txs_.push_back(to_shared(std::move(tx)));
+
+                return true;
+            }
+            case node::block:
+            {
+                *block_out_ = chain::block{ header_,
+                    to_shared(std::move(txs_)) };
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    // Outputs.
+    transaction* const tx_out_;
+    transactions* const txs_out_;
+    block* const block_out_;
+
+    // Parse state.
+    std::vector<frame> frames_{};
+    std::string part_{};
+    field key_{ field::none };
+    bool complete_{};
+
+    // Member values.
+    hash_digest hash_{};
+    hash_digest previous_{};
+    hash_digest merkle_root_{};
+    chain::script script_{};
+    chain::witness witness_{};
+    uint64_t value_{};
+    uint32_t version_{};
+    uint32_t timestamp_{};
+    uint32_t bits_{};
+    uint32_t nonce_{};
+    uint32_t locktime_{};
+    uint32_t sequence_{};
+    uint32_t index_{};
+
+    // Collected elements.
+    input_cptrs inputs_{};
+    output_cptrs outputs_{};
+    transaction_cptrs txs_{};
+    header::cptr header_{};
+};
+
+static bool parse(const std::string_view& text, transaction* tx,
+    transactions* txs, block* block) NOEXCEPT
+{
+    json::basic_parser<json_builder> parser{ json::parse_options{}, tx, txs,
+        block };
+
+    json::error_code ec{};
+    const auto size = parser.write_some(false, text.data(), text.size(), ec);
+    return !ec && size == text.size() && parser.handler().complete();
+}
+
+bool from_json(transaction& out, const std::string_view& text) NOEXCEPT
+{
+    return parse(text, &out, nullptr, nullptr);
+}
+
+bool from_json(transactions& out, const std::string_view& text) NOEXCEPT
+{
+    out.clear();
+    return parse(text, nullptr, &out, nullptr);
+}
+
+bool from_json(block& out, const std::string_view& text) NOEXCEPT
+{
+    return parse(text, nullptr, nullptr, &out);
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
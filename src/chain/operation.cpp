@@ -82,9 +82,7 @@ operation::operation(const chunk_cptr& push_data, bool minimal) NOEXCEPT
 }
 
 operation::operation(const data_slice& op_data) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : operation(stream::in::copy(op_data))
-    BC_POP_WARNING()
+  : operation(span_reader(op_data))
 {
 }
 
@@ -108,6 +106,16 @@ operation::operation(reader& source) NOEXCEPT
 {
 }
 
+operation::operation(span_reader&& source) NOEXCEPT
+  : operation(from_data(source))
+{
+}
+
+operation::operation(span_reader& source) NOEXCEPT
+  : operation(from_data(source))
+{
+}
+
 operation::operation(const std::string& mnemonic) NOEXCEPT
   : operation(from_string(mnemonic))
 {
@@ -139,7 +147,8 @@ bool operation::operator!=(const operation& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-operation operation::from_data(reader& source) NOEXCEPT
+template <typename Source>
+operation operation::from_data(Source& source) NOEXCEPT
 {
     // Guard against resetting a previously-invalid stream.
     if (!source)
@@ -473,10 +482,23 @@ size_t operation::serialized_size() const NOEXCEPT
 // Utilities.
 // ----------------------------------------------------------------------------
 
+// static/private
+bool operation::count_op(reader& source) NOEXCEPT
+{
+    return do_count_op(source);
+}
+
+// static/private
+bool operation::count_op(span_reader& source) NOEXCEPT
+{
+    return do_count_op(source);
+}
+
 // static/private
 // Advances stream, returns true unless exhausted.
 // Does not advance to end position in the case of underflow operation.
-bool operation::count_op(reader& source) NOEXCEPT
+template <typename Source>
+bool operation::do_count_op(Source& source) NOEXCEPT
 {
     if (source.is_exhausted())
         return false;
@@ -487,7 +509,8 @@ bool operation::count_op(reader& source) NOEXCEPT
 }
 
 // static/private
-uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
+template <typename Source>
+uint32_t operation::read_data_size(opcode code, Source& source) NOEXCEPT
 {
     constexpr auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
 
@@ -59,9 +59,7 @@ output::output(uint64_t value, const chain::script::cptr& script) NOEXCEPT
 }
 
 output::output(const data_slice& data) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : output(stream::in::copy(data))
-    BC_POP_WARNING()
+  : output(span_reader(data))
 {
 }
 
@@ -85,6 +83,16 @@ output::output(reader& source) NOEXCEPT
 {
 }
 
+output::output(span_reader&& source) NOEXCEPT
+  : output(from_data(source))
+{
+}
+
+output::output(span_reader& source) NOEXCEPT
+  : output(from_data(source))
+{
+}
+
 // protected
 output::output(uint64_t value, const chain::script::cptr& script,
     bool valid) NOEXCEPT
@@ -110,7 +118,8 @@ bool output::operator!=(const output& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-output output::from_data(reader& source) NOEXCEPT
+template <typename Source>
+output output::from_data(Source& source) NOEXCEPT
 {
     return
     {
@@ -266,6 +275,16 @@ void tag_invoke(json::value_from_tag tag, json::value& value,
 BC_POP_WARNING()
 BC_POP_WARNING()
 
+// props
+// ----------------------------------------------------------------------------
+
+void to_props(props_writer& writer, const output& output) NOEXCEPT
+{
+    writer.begin_object().name("value").number(output.value()).name("script");
+    to_props(writer, output.script());
+    writer.end_object();
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
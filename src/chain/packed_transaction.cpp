@@ -0,0 +1,387 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/packed_transaction.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+constexpr auto slot_size = sizeof(uint32_t);
+constexpr auto sequence_size = sizeof(uint32_t);
+constexpr auto locktime_size = sizeof(uint32_t);
+constexpr auto value_size = sizeof(uint64_t);
+
+// Vector allocation aborts.
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+packed_transaction::packed_transaction() NOEXCEPT
+  : buffer_(), inputs_(), outputs_(), segregated_(false), valid_(false)
+{
+}
+
+packed_transaction::packed_transaction(const transaction& tx) NOEXCEPT
+  : packed_transaction(tx.to_data(true))
+{
+}
+
+// Elements are skipped over, recording offsets to each, so that the buffer
+// may be allocated once. The sequence of reads mirrors transaction::from_data.
+packed_transaction::packed_transaction(const data_slice& data) NOEXCEPT
+  : packed_transaction()
+{
+    std::vector<uint32_t> offsets{};
+    span_reader source{ data };
+    const auto position = [&]() NOEXCEPT
+    {
+        return possible_narrow_cast<uint32_t>(source.get_read_position());
+    };
+
+    source.skip_bytes(sizeof(uint32_t));
+    auto inputs = source.read_size(max_block_size);
+    const auto segregated = inputs == witness_marker &&
+        source.peek_byte() == witness_enabled;
+
+    if (segregated)
+    {
+        source.skip_byte();
+        inputs = source.read_size(max_block_size);
+    }
+
+    for (auto input = zero; input < inputs && source; ++input)
+    {
+        offsets.push_back(position());
+        source.skip_bytes(point::serialized_size());
+        source.skip_bytes(source.read_size(max_block_size));
+        source.skip_bytes(sequence_size);
+    }
+
+    offsets.push_back(position());
+    const auto outputs = source.read_size(max_block_size);
+
+    for (auto output = zero; output < outputs && source; ++output)
+    {
+        offsets.push_back(position());
+        source.skip_bytes(value_size);
+        source.skip_bytes(source.read_size(max_block_size));
+    }
+
+    offsets.push_back(position());
+
+    if (segregated)
+    {
+        for (auto input = zero; input < inputs && source; ++input)
+        {
+            offsets.push_back(position());
+            witness::skip(source, true);
+        }
+
+        offsets.push_back(position());
+    }
+
+    source.skip_bytes(locktime_size);
+    if (!source)
+        return;
+
+    const auto table = offsets.size() * slot_size;
+    const auto size = source.get_read_position();
+    buffer_.resize(table + size);
+
+    auto it = buffer_.data();
+    for (const auto offset: offsets)
+    {
+        unsafe_to_little_endian<uint32_t>(it, offset);
+        it += slot_size;
+    }
+
+    std::copy_n(data.begin(), size, it);
+    inputs_ = possible_narrow_cast<uint32_t>(inputs);
+    outputs_ = possible_narrow_cast<uint32_t>(outputs);
+    segregated_ = segregated;
+    valid_ = true;
+}
+
+// Operators.
+// ----------------------------------------------------------------------------
+
+bool packed_transaction::operator==(
+    const packed_transaction& other) const NOEXCEPT
+{
+    // Offsets are a function of the serialization.
+    return buffer_ == other.buffer_;
+}
+
+bool packed_transaction::operator!=(
+    const packed_transaction& other) const NOEXCEPT
+{
+    return !(*this == other);
+}
+
+// Serialization.
+// ----------------------------------------------------------------------------
+
+data_chunk packed_transaction::to_data(bool witness) const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    witness &= segregated_;
+    const auto data = wire();
+
+    if (witness)
+        return { data.begin(), data.end() };
+
+    // Drop marker, flag and witnesses (bip144).
+    data_chunk out(serialized_size(false));
+    const auto body = output_offset(outputs_) - prefix_size();
+    auto it = std::copy_n(data.begin(), sizeof(uint32_t), out.begin());
+    it = std::copy_n(std::next(data.begin(), prefix_size()), body, it);
+    std::copy_n(std::next(data.begin(), locktime_offset()), locktime_size, it);
+    return out;
+}
+
+transaction packed_transaction::to_transaction() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    return { wire(), true };
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool packed_transaction::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+bool packed_transaction::is_segregated() const NOEXCEPT
+{
+    return segregated_;
+}
+
+uint32_t packed_transaction::version() const NOEXCEPT
+{
+    return valid_ ? unsafe_from_little_endian<uint32_t>(wire().data()) : 0;
+}
+
+uint32_t packed_transaction::locktime() const NOEXCEPT
+{
+    return valid_ ? unsafe_from_little_endian<uint32_t>(
+        std::next(wire().data(), locktime_offset())) : 0;
+}
+
+size_t packed_transaction::input_count() const NOEXCEPT
+{
+    return inputs_;
+}
+
+size_t packed_transaction::output_count() const NOEXCEPT
+{
+    return outputs_;
+}
+
+chain::point packed_transaction::point(size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < inputs_);
+    const auto begin = input_offset(index);
+    return { slice(begin, begin + point::serialized_size()) };
+}
+
+uint32_t packed_transaction::sequence(size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < inputs_);
+    const auto end = input_offset(add1(index));
+    return unsafe_from_little_endian<uint32_t>(
+        std::next(wire().data(), end - sequence_size));
+}
+
+uint64_t packed_transaction::value(size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < outputs_);
+    return unsafe_from_little_endian<uint64_t>(
+        std::next(wire().data(), output_offset(index)));
+}
+
+chain::input packed_transaction::input(size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < inputs_);
+    const chain::input input
+    {
+        slice(input_offset(index), input_offset(add1(index)))
+    };
+
+    if (!segregated_)
+        return input;
+
+    return
+    {
+        input.point_ptr(),
+        input.script_ptr(),
+        to_shared<chain::witness>(slice(witness_offset(index),
+            witness_offset(add1(index))), true),
+        input.sequence()
+    };
+}
+
+chain::output packed_transaction::output(size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < outputs_);
+    return { slice(output_offset(index), output_offset(add1(index))) };
+}
+
+size_t packed_transaction::serialized_size(bool witness) const NOEXCEPT
+{
+    if (!valid_)
+        return zero;
+
+    if (witness && segregated_)
+        return wire().size();
+
+    return sizeof(uint32_t) + (output_offset(outputs_) - prefix_size()) +
+        locktime_size;
+}
+
+// Transactions with empty witnesses always use old serialization (bip144).
+hash_digest packed_transaction::hash(bool witness) const NOEXCEPT
+{
+    if (!valid_)
+        return null_hash;
+
+    witness &= segregated_;
+
+    // Witness coinbase tx hash is assumed to be null_hash (bip141).
+    if (witness && is_coinbase())
+        return null_hash;
+
+    const auto data = wire();
+    accumulator<sha256> context{};
+
+    if (witness)
+    {
+        context.write(data.size(), data.data());
+    }
+    else
+    {
+        context.write(sizeof(uint32_t), data.data());
+        context.write(output_offset(outputs_) - prefix_size(),
+            std::next(data.data(), prefix_size()));
+        context.write(locktime_size,
+            std::next(data.data(), locktime_offset()));
+    }
+
+    return context.double_flush();
+}
+
+bool packed_transaction::is_coinbase() const NOEXCEPT
+{
+    return is_one(inputs_) && point(zero).is_null();
+}
+
+size_t packed_transaction::buffer_size() const NOEXCEPT
+{
+    return buffer_.size();
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+size_t packed_transaction::slots() const NOEXCEPT
+{
+    if (!valid_)
+        return zero;
+
+    const auto inputs = add1<size_t>(inputs_);
+    const auto outputs = add1<size_t>(outputs_);
+    return inputs + outputs + (segregated_ ? inputs : zero);
+}
+
+size_t packed_transaction::offset(size_t slot) const NOEXCEPT
+{
+    BC_ASSERT(slot < slots());
+    return unsafe_from_little_endian<uint32_t>(
+        std::next(buffer_.data(), slot * slot_size));
+}
+
+size_t packed_transaction::input_offset(size_t index) const NOEXCEPT
+{
+    return offset(index);
+}
+
+size_t packed_transaction::output_offset(size_t index) const NOEXCEPT
+{
+    return offset(add1<size_t>(inputs_) + index);
+}
+
+size_t packed_transaction::witness_offset(size_t index) const NOEXCEPT
+{
+    return offset(add1<size_t>(inputs_) + add1<size_t>(outputs_) + index);
+}
+
+size_t packed_transaction::locktime_offset() const NOEXCEPT
+{
+    return segregated_ ? witness_offset(inputs_) : output_offset(outputs_);
+}
+
+size_t packed_transaction::prefix_size() const NOEXCEPT
+{
+    // Version, and marker and flag if segregated.
+    return sizeof(uint32_t) + (segregated_ ? two : zero);
+}
+
+data_slice packed_transaction::wire() const NOEXCEPT
+{
+    const auto begin = buffer_.data();
+    return { std::next(begin, slots() * slot_size),
+        std::next(begin, buffer_.size()) };
+}
+
+data_slice packed_transaction::slice(size_t begin, size_t end) const NOEXCEPT
+{
+    const auto data = wire().data();
+    return { std::next(data, begin), std::next(data, end) };
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -103,9 +103,7 @@ script::script(const operations& ops, bool prefail) NOEXCEPT
 }
 
 script::script(const data_slice& data, bool prefix) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : script(stream::in::copy(data), prefix)
-    BC_POP_WARNING()
+  : script(span_reader(data), prefix)
 {
 }
 
@@ -129,6 +127,16 @@ script::script(reader& source, bool prefix) NOEXCEPT
 {
 }
 
+script::script(span_reader&& source, bool prefix) NOEXCEPT
+  : script(from_data(source, prefix))
+{
+}
+
+script::script(span_reader& source, bool prefix) NOEXCEPT
+  : script(from_data(source, prefix))
+{
+}
+
 script::script(const std::string& mnemonic) NOEXCEPT
   : script(from_string(mnemonic))
 {
@@ -181,7 +189,8 @@ bool script::operator!=(const script& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-size_t script::op_count(reader& source) NOEXCEPT
+template <typename Source>
+size_t script::op_count(Source& source) NOEXCEPT
 {
     // Stream errors reset by set_position so trap here.
     if (!source)
@@ -198,7 +207,8 @@ size_t script::op_count(reader& source) NOEXCEPT
 }
 
 // static/private
-script script::from_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+script script::from_data(Source& source, bool prefix) NOEXCEPT
 {
     auto size = zero;
     auto start = zero;
@@ -557,6 +567,14 @@ void tag_invoke(json::value_from_tag tag, json::value& value,
 BC_POP_WARNING()
 BC_POP_WARNING()
 
+// props
+// ----------------------------------------------------------------------------
+
+void to_props(props_writer& writer, const script& script) NOEXCEPT
+{
+    writer.text(script.to_string(forks::all_rules));
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
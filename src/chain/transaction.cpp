@@ -121,9 +121,7 @@ transaction::transaction(uint32_t version, const chain::inputs_cptr& inputs,
 }
 
 transaction::transaction(const data_slice& data, bool witness) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : transaction(stream::in::copy(data), witness)
-    BC_POP_WARNING()
+  : transaction(span_reader(data), witness)
 {
 }
 
@@ -147,6 +145,16 @@ transaction::transaction(reader& source, bool witness) NOEXCEPT
 {
 }
 
+transaction::transaction(span_reader&& source, bool witness) NOEXCEPT
+  : transaction(from_data(source, witness))
+{
+}
+
+transaction::transaction(span_reader& source, bool witness) NOEXCEPT
+  : transaction(from_data(source, witness))
+{
+}
+
 // protected
 transaction::transaction(uint32_t version,
     const chain::inputs_cptr& inputs, const chain::outputs_cptr& outputs,
@@ -225,7 +233,8 @@ read_puts(Source& source) NOEXCEPT
 }
 
 // static/private
-transaction transaction::from_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+transaction transaction::from_data(Source& source, bool witness) NOEXCEPT
 {
     const auto version = source.read_4_bytes_little_endian();
 
@@ -401,6 +410,24 @@ void transaction::set_witness_hash(hash_digest&& hash) const NOEXCEPT
     BC_POP_WARNING()
 }
 
+bool transaction::is_hashed(bool witness) const NOEXCEPT
+{
+    return witness ? !!witness_hash_ : !!hash_;
+}
+
+void transaction::set_signature_hashes(hash_digest&& outputs,
+    hash_digest&& points, hash_digest&& sequences) const NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    cache_ = std::make_unique<hash_cache>(hash_cache
+    {
+        std::move(outputs),
+        std::move(points),
+        std::move(sequences)
+    });
+    BC_POP_WARNING()
+}
+
 hash_digest transaction::hash(bool witness) const NOEXCEPT
 {
     if (segregated_)
@@ -1298,8 +1325,33 @@ code transaction::confirm(const context& ctx) const NOEXCEPT
 // Connect (contextual).
 // ----------------------------------------------------------------------------
 
+static bool is_roller(const input& in) NOEXCEPT
+{
+    static const auto roll = operation{ opcode::roll };
+
+    // Naive implementation, any op_roll in either script, late-counted.
+    // TODO: precompute on script parse, tune using performance profiling.
+    return contains(in.script().ops(), roll)
+        || (in.prevout && contains(in.prevout->script().ops(), roll));
+}
+
+static code connect_input(const context& ctx, const transaction& tx,
+    const input_cptrs::const_iterator& input,
+    signature_cache* signatures) NOEXCEPT
+{
+    using namespace machine;
+
+    // Evaluate rolling scripts with linear search but constant erase.
+    // Evaluate non-rolling scripts with constant search but linear erase,
+    // using fixed (non-allocating) elements and thread arena chunks.
+    return is_roller(**input) ?
+        interpreter<linked_stack>::connect(ctx, tx, input, signatures) :
+        interpreter<arena_stack>::connect(ctx, tx, input, signatures);
+}
+
 // Do NOT invoke on coinbase.
-code transaction::connect(const context& ctx) const NOEXCEPT
+code transaction::connect(const context& ctx,
+    signature_cache* signatures) const NOEXCEPT
 {
     BC_ASSERT(!is_coinbase());
 
@@ -1307,35 +1359,49 @@ code transaction::connect(const context& ctx) const NOEXCEPT
     ////    return error::transaction_success;
 
     code ec;
-    using namespace machine;
     initialize_hash_cache();
-    
-    const auto is_roller = [](const auto& input) NOEXCEPT
-    {
-        static const auto roll = operation{ opcode::roll };
-
-        // Naive implementation, any op_roll in either script, late-counted.
-        // TODO: precompute on script parse, tune using performance profiling.
-        return contains(input.script().ops(), roll)
-            || (input.prevout && contains(input.prevout->script().ops(), roll));
-    };
 
     // Validate scripts.
     for (auto input = inputs_->begin(); input != inputs_->end(); ++input)
-    {
-        // Evaluate rolling scripts with linear search but constant erase.
-        // Evaluate non-rolling scripts with constant search but linear erase.
-        if ((ec = is_roller(**input) ?
-            interpreter<linked_stack>::connect(ctx, *this, input) :
-            interpreter<contiguous_stack>::connect(ctx, *this, input)))
+        if ((ec = connect_input(ctx, *this, input, signatures)))
             return ec;
-    }
 
     // TODO: accumulate sigops from each connect result and add coinbase.
     // TODO: return in override with out parameter. more impactful with segwit.
     return error::transaction_success;
 }
 
+// Do NOT invoke on coinbase.
+// Inputs previously verified under the same forks are skipped. Keying on the
+// witness hash commits to the full input script and witness, and prevouts are
+// committed by the point, so only a successful result is reused.
+code transaction::connect(const context& ctx,
+    machine::verification_cache& cache,
+    signature_cache* signatures) const NOEXCEPT
+{
+    BC_ASSERT(!is_coinbase());
+
+    code ec;
+    initialize_hash_cache();
+    const auto key = hash(true);
+
+    // Validate scripts.
+    uint32_t index{};
+    for (auto input = inputs_->begin(); input != inputs_->end();
+        ++input, ++index)
+    {
+        if (cache.contains(key, index, ctx.forks))
+            continue;
+
+        if ((ec = connect_input(ctx, *this, input, signatures)))
+            return ec;
+
+        cache.insert(key, index, ctx.forks);
+    }
+
+    return error::transaction_success;
+}
+
 // JSON value convertors.
 // ----------------------------------------------------------------------------
 
@@ -1389,6 +1455,23 @@ void tag_invoke(json::value_from_tag tag, json::value& value,
 BC_POP_WARNING()
 BC_POP_WARNING()
 
+// props
+// ----------------------------------------------------------------------------
+
+void to_props(props_writer& writer, const transaction& tx) NOEXCEPT
+{
+    writer.begin_object().name("version").number(tx.version());
+    writer.name("inputs").begin_array("input");
+    for (const auto& input: *tx.inputs_ptr())
+        to_props(writer, *input);
+
+    writer.end_array().name("outputs").begin_array("output");
+    for (const auto& output: *tx.outputs_ptr())
+        to_props(writer, *output);
+
+    writer.end_array().name("locktime").number(tx.locktime()).end_object();
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
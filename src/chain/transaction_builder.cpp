@@ -0,0 +1,445 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/transaction_builder.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Segment positions (witness segments are hashed for witness hash only):
+// [version|marker|flag|input count][inputs][output count][outputs]
+// [witnesses][locktime]
+
+// Vector growth aborts.
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+transaction_builder::transaction_builder(uint32_t version,
+    uint32_t locktime) NOEXCEPT
+  : version_(version), inputs_(), outputs_(), locktime_(locktime),
+    inputs_data_(), outputs_data_(), witnesses_data_()
+{
+}
+
+transaction_builder::transaction_builder(const transaction& tx) NOEXCEPT
+  : version_(tx.version()),
+    inputs_(*tx.inputs_ptr()),
+    outputs_(*tx.outputs_ptr()),
+    locktime_(tx.locktime()),
+    inputs_data_(inputs_.size()),
+    outputs_data_(outputs_.size()),
+    witnesses_data_(inputs_.size())
+{
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+uint32_t transaction_builder::version() const NOEXCEPT
+{
+    return version_;
+}
+
+uint32_t transaction_builder::locktime() const NOEXCEPT
+{
+    return locktime_;
+}
+
+const input_cptrs& transaction_builder::inputs() const NOEXCEPT
+{
+    return inputs_;
+}
+
+const output_cptrs& transaction_builder::outputs() const NOEXCEPT
+{
+    return outputs_;
+}
+
+bool transaction_builder::is_segregated() const NOEXCEPT
+{
+    const auto witnessed = [](const auto& input) NOEXCEPT
+    {
+        return !input->witness().stack().empty();
+    };
+
+    return std::any_of(inputs_.begin(), inputs_.end(), witnessed);
+}
+
+// Edits.
+// ----------------------------------------------------------------------------
+
+void transaction_builder::set_version(uint32_t version) NOEXCEPT
+{
+    version_ = version;
+    hash_.invalidate(zero);
+    witness_hash_.invalidate(zero);
+}
+
+void transaction_builder::set_locktime(uint32_t locktime) NOEXCEPT
+{
+    locktime_ = locktime;
+    hash_.invalidate(locktime_position(false));
+    witness_hash_.invalidate(locktime_position(true));
+}
+
+void transaction_builder::set_input(size_t index,
+    const input::cptr& input) NOEXCEPT
+{
+    BC_ASSERT(index < inputs_.size());
+    inputs_[index] = input;
+    inputs_data_[index].clear();
+    witnesses_data_[index].clear();
+    points_hash_.invalidate(index);
+    invalidate_input(index);
+}
+
+void transaction_builder::set_sequence(size_t index,
+    uint32_t sequence) NOEXCEPT
+{
+    BC_ASSERT(index < inputs_.size());
+    const auto& prior = *inputs_[index];
+    inputs_[index] = to_shared<input>(prior.point_ptr(), prior.script_ptr(),
+        prior.witness_ptr(), sequence);
+
+    // Sequence is the serialized input suffix.
+    auto& data = inputs_data_[index];
+    if (!data.empty())
+    {
+        const auto bytes = to_little_endian(sequence);
+        std::copy(bytes.begin(), bytes.end(), std::prev(data.end(),
+            bytes.size()));
+    }
+
+    invalidate_input(index);
+}
+
+void transaction_builder::push_input(const input::cptr& input) NOEXCEPT
+{
+    points_hash_.invalidate(inputs_.size());
+    sequences_hash_.invalidate(inputs_.size());
+    inputs_.push_back(input);
+    inputs_data_.emplace_back();
+    witnesses_data_.emplace_back();
+
+    // Input count is serialized in the first segment.
+    hash_.invalidate(zero);
+    witness_hash_.invalidate(zero);
+}
+
+void transaction_builder::erase_input(size_t index) NOEXCEPT
+{
+    BC_ASSERT(index < inputs_.size());
+    const auto offset = to_signed(index);
+    inputs_.erase(std::next(inputs_.begin(), offset));
+    inputs_data_.erase(std::next(inputs_data_.begin(), offset));
+    witnesses_data_.erase(std::next(witnesses_data_.begin(), offset));
+    points_hash_.invalidate(index);
+    sequences_hash_.invalidate(index);
+    hash_.invalidate(zero);
+    witness_hash_.invalidate(zero);
+}
+
+void transaction_builder::set_output(size_t index,
+    const output::cptr& output) NOEXCEPT
+{
+    BC_ASSERT(index < outputs_.size());
+    outputs_[index] = output;
+    outputs_data_[index].clear();
+    invalidate_output(index);
+}
+
+void transaction_builder::set_value(size_t index, uint64_t value) NOEXCEPT
+{
+    BC_ASSERT(index < outputs_.size());
+    outputs_[index] = to_shared<output>(value, outputs_[index]->script_ptr());
+
+    // Value is the serialized output prefix.
+    auto& data = outputs_data_[index];
+    if (!data.empty())
+    {
+        const auto bytes = to_little_endian(value);
+        std::copy(bytes.begin(), bytes.end(), data.begin());
+    }
+
+    invalidate_output(index);
+}
+
+void transaction_builder::push_output(const output::cptr& output) NOEXCEPT
+{
+    outputs_hash_.invalidate(outputs_.size());
+    outputs_.push_back(output);
+    outputs_data_.emplace_back();
+
+    // Output count is serialized in the segment that follows the inputs.
+    hash_.invalidate(output_position(zero) - one);
+    witness_hash_.invalidate(output_position(zero) - one);
+}
+
+void transaction_builder::erase_output(size_t index) NOEXCEPT
+{
+    BC_ASSERT(index < outputs_.size());
+    const auto offset = to_signed(index);
+    outputs_.erase(std::next(outputs_.begin(), offset));
+    outputs_data_.erase(std::next(outputs_data_.begin(), offset));
+    outputs_hash_.invalidate(index);
+    hash_.invalidate(output_position(zero) - one);
+    witness_hash_.invalidate(output_position(zero) - one);
+}
+
+// Hashes.
+// ----------------------------------------------------------------------------
+
+hash_digest transaction_builder::hash(bool witness) const NOEXCEPT
+{
+    const auto segregated = is_segregated();
+    witness &= segregated;
+
+    // Witness coinbase tx hash is assumed to be null_hash (bip141).
+    if (witness && is_coinbase())
+        return null_hash;
+
+    const auto count = add1(locktime_position(witness));
+    const auto write = [&](context& context, size_t position) NOEXCEPT
+    {
+        write_segment(context, position, witness);
+    };
+
+    return compute(witness ? witness_hash_ : hash_, count, write);
+}
+
+hash_digest transaction_builder::outputs_hash() const NOEXCEPT
+{
+    return compute(outputs_hash_, outputs_.size(),
+        [&](context& context, size_t index) NOEXCEPT
+        {
+            context.write(output_data(index));
+        });
+}
+
+hash_digest transaction_builder::points_hash() const NOEXCEPT
+{
+    // Point is the serialized input prefix.
+    return compute(points_hash_, inputs_.size(),
+        [&](context& context, size_t index) NOEXCEPT
+        {
+            context.write(point::serialized_size(), input_data(index).data());
+        });
+}
+
+hash_digest transaction_builder::sequences_hash() const NOEXCEPT
+{
+    // Sequence is the serialized input suffix.
+    return compute(sequences_hash_, inputs_.size(),
+        [&](context& context, size_t index) NOEXCEPT
+        {
+            const auto& data = input_data(index);
+            context.write(sizeof(uint32_t),
+                &(*std::prev(data.end(), sizeof(uint32_t))));
+        });
+}
+
+transaction transaction_builder::to_transaction() const NOEXCEPT
+{
+    const transaction tx
+    {
+        version_,
+        to_shared(inputs_),
+        to_shared(outputs_),
+        locktime_
+    };
+
+    if (hash_.current)
+        tx.set_hash(hash_digest{ hash_.digest });
+
+    if (witness_hash_.current && tx.is_segregated())
+        tx.set_witness_hash(hash_digest{ witness_hash_.digest });
+
+    if (outputs_hash_.current && points_hash_.current &&
+        sequences_hash_.current)
+        tx.set_signature_hashes(hash_digest{ outputs_hash_.digest },
+            hash_digest{ points_hash_.digest },
+            hash_digest{ sequences_hash_.digest });
+
+    return tx;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+void transaction_builder::midstates::invalidate(size_t position) NOEXCEPT
+{
+    valid = std::min(valid, position);
+    current = false;
+}
+
+// Resume from the last valid state, retaining the state of each segment.
+template <typename Write>
+const hash_digest& transaction_builder::compute(midstates& cache,
+    size_t count, Write&& write) NOEXCEPT
+{
+    if (cache.current)
+        return cache.digest;
+
+    cache.states.resize(count);
+    auto context = is_zero(cache.valid) ? transaction_builder::context{} :
+        cache.states[sub1(cache.valid)];
+
+    for (auto position = cache.valid; position < count; ++position)
+    {
+        write(context, position);
+        cache.states[position] = context;
+    }
+
+    cache.valid = count;
+    cache.digest = context.double_flush();
+    cache.current = true;
+    return cache.digest;
+}
+
+bool transaction_builder::is_coinbase() const NOEXCEPT
+{
+    return inputs_.size() == one && inputs_.front()->point().is_null();
+}
+
+size_t transaction_builder::output_position(size_t index) const NOEXCEPT
+{
+    return inputs_.size() + two + index;
+}
+
+size_t transaction_builder::locktime_position(bool witness) const NOEXCEPT
+{
+    return output_position(outputs_.size()) +
+        (witness ? inputs_.size() : zero);
+}
+
+void transaction_builder::invalidate_input(size_t index) NOEXCEPT
+{
+    sequences_hash_.invalidate(index);
+    hash_.invalidate(add1(index));
+    witness_hash_.invalidate(add1(index));
+}
+
+void transaction_builder::invalidate_output(size_t index) NOEXCEPT
+{
+    outputs_hash_.invalidate(index);
+    hash_.invalidate(output_position(index));
+    witness_hash_.invalidate(output_position(index));
+}
+
+void transaction_builder::write_segment(context& context, size_t position,
+    bool witness) const NOEXCEPT
+{
+    const auto inputs = inputs_.size();
+    const auto outputs = outputs_.size();
+
+    if (is_zero(position))
+    {
+        data_chunk data{};
+        write::bytes::data sink(data);
+        sink.write_4_bytes_little_endian(version_);
+
+        if (witness)
+        {
+            sink.write_byte(witness_marker);
+            sink.write_byte(witness_enabled);
+        }
+
+        sink.write_variable(inputs);
+        sink.flush();
+        context.write(data);
+    }
+    else if (position <= inputs)
+    {
+        context.write(input_data(sub1(position)));
+    }
+    else if (position == add1(inputs))
+    {
+        data_chunk data{};
+        write::bytes::data sink(data);
+        sink.write_variable(outputs);
+        sink.flush();
+        context.write(data);
+    }
+    else if (position < output_position(outputs))
+    {
+        context.write(output_data(position - output_position(zero)));
+    }
+    else if (position < locktime_position(witness))
+    {
+        context.write(witness_data(position - output_position(outputs)));
+    }
+    else
+    {
+        context.write(to_little_endian(locktime_));
+    }
+}
+
+const data_chunk& transaction_builder::input_data(size_t index) const NOEXCEPT
+{
+    auto& data = inputs_data_[index];
+    if (data.empty())
+        data = inputs_[index]->to_data();
+
+    return data;
+}
+
+const data_chunk& transaction_builder::output_data(
+    size_t index) const NOEXCEPT
+{
+    auto& data = outputs_data_[index];
+    if (data.empty())
+        data = outputs_[index]->to_data();
+
+    return data;
+}
+
+const data_chunk& transaction_builder::witness_data(
+    size_t index) const NOEXCEPT
+{
+    auto& data = witnesses_data_[index];
+    if (data.empty())
+        data = inputs_[index]->witness().to_data(true);
+
+    return data;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
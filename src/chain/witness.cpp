@@ -69,9 +69,7 @@ witness::witness(const chunk_cptrs& stack) NOEXCEPT
 }
 
 witness::witness(const data_slice& data, bool prefix) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : witness(stream::in::copy(data), prefix)
-    BC_POP_WARNING()
+  : witness(span_reader(data), prefix)
 {
 }
 
@@ -95,6 +93,16 @@ witness::witness(reader& source, bool prefix) NOEXCEPT
 {
 }
 
+witness::witness(span_reader&& source, bool prefix) NOEXCEPT
+  : witness(from_data(source, prefix))
+{
+}
+
+witness::witness(span_reader& source, bool prefix) NOEXCEPT
+  : witness(from_data(source, prefix))
+{
+}
+
 witness::witness(const std::string& mnemonic) NOEXCEPT
   : witness(from_string(mnemonic))
 {
@@ -129,6 +137,18 @@ bool witness::operator!=(const witness& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 void witness::skip(reader& source, bool prefix) NOEXCEPT
+{
+    do_skip(source, prefix);
+}
+
+void witness::skip(span_reader& source, bool prefix) NOEXCEPT
+{
+    do_skip(source, prefix);
+}
+
+// static/private
+template <typename Source>
+void witness::do_skip(Source& source, bool prefix) NOEXCEPT
 {
     if (prefix)
     {
@@ -144,14 +164,16 @@ void witness::skip(reader& source, bool prefix) NOEXCEPT
     }
 }
 
-static data_chunk read_element(reader& source) NOEXCEPT
+template <typename Source>
+static data_chunk read_element(Source& source) NOEXCEPT
 {
     // Each witness encoded as variable integer prefixed byte array (bip144).
     return source.read_bytes(source.read_size(max_block_weight));
 }
 
 // static/private
-witness witness::from_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+witness witness::from_data(Source& source, bool prefix) NOEXCEPT
 {
     chunk_cptrs stack;
 
@@ -459,6 +481,14 @@ void tag_invoke(json::value_from_tag tag, json::value& value,
 BC_POP_WARNING()
 BC_POP_WARNING()
 
+// props
+// ----------------------------------------------------------------------------
+
+void to_props(props_writer& writer, const witness& witness) NOEXCEPT
+{
+    writer.text(witness.to_string());
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
@@ -21,6 +21,7 @@
 
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
@@ -383,6 +384,279 @@ constexpr void decrypt_block(aes256::context& context, block& bytes) NOEXCEPT
     add_round_key_lower(bytes, context.key);
 }
 
+// native
+// ----------------------------------------------------------------------------
+// Round keys are expanded once, with inverse (aesimc) keys for decryption.
+// intel.com/content/dam/doc/white-paper/advanced-encryption-standard-new-instructions-set-paper.pdf
+
+#if defined(HAVE_AESNI)
+
+namespace native {
+
+typedef std_array<__m128i, add1(rounds)> schedule;
+
+template <int Round>
+INLINE void expand_even(__m128i& even, __m128i odd) NOEXCEPT
+{
+    const auto assist = _mm_aeskeygenassist_si128(odd, Round);
+    const auto word = _mm_shuffle_epi32(assist, 0xff);
+    even = _mm_xor_si128(even, _mm_slli_si128(even, 4));
+    even = _mm_xor_si128(even, _mm_slli_si128(even, 4));
+    even = _mm_xor_si128(even, _mm_slli_si128(even, 4));
+    even = _mm_xor_si128(even, word);
+}
+
+INLINE void expand_odd(__m128i even, __m128i& odd) NOEXCEPT
+{
+    const auto assist = _mm_aeskeygenassist_si128(even, 0);
+    const auto word = _mm_shuffle_epi32(assist, 0xaa);
+    odd = _mm_xor_si128(odd, _mm_slli_si128(odd, 4));
+    odd = _mm_xor_si128(odd, _mm_slli_si128(odd, 4));
+    odd = _mm_xor_si128(odd, _mm_slli_si128(odd, 4));
+    odd = _mm_xor_si128(odd, word);
+}
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+INLINE __m128i load(const uint8_t& bytes) NOEXCEPT
+{
+    return _mm_loadu_si128(pointer_cast<const __m128i>(&bytes));
+}
+
+INLINE void store(uint8_t& bytes, __m128i value) NOEXCEPT
+{
+    _mm_storeu_si128(pointer_cast<__m128i>(&bytes), value);
+}
+
+static void encryption_schedule(schedule& keys, const secret& key) NOEXCEPT
+{
+    auto even = load(key[0]);
+    auto odd = load(key[block_size]);
+    keys[0] = even;
+    keys[1] = odd;
+
+    // Round constants must be immediates.
+    expand_even<0x01>(even, odd); keys[2] = even;
+    expand_odd(even, odd);        keys[3] = odd;
+    expand_even<0x02>(even, odd); keys[4] = even;
+    expand_odd(even, odd);        keys[5] = odd;
+    expand_even<0x04>(even, odd); keys[6] = even;
+    expand_odd(even, odd);        keys[7] = odd;
+    expand_even<0x08>(even, odd); keys[8] = even;
+    expand_odd(even, odd);        keys[9] = odd;
+    expand_even<0x10>(even, odd); keys[10] = even;
+    expand_odd(even, odd);        keys[11] = odd;
+    expand_even<0x20>(even, odd); keys[12] = even;
+    expand_odd(even, odd);        keys[13] = odd;
+    expand_even<0x40>(even, odd); keys[14] = even;
+}
+
+static void decryption_schedule(schedule& keys, const secret& key) NOEXCEPT
+{
+    schedule forward{};
+    encryption_schedule(forward, key);
+
+    keys[0] = forward[rounds];
+    for (size_t round = 1; round < rounds; ++round)
+        keys[round] = _mm_aesimc_si128(forward[rounds - round]);
+
+    keys[rounds] = forward[0];
+}
+
+// Four independent blocks per iteration hides aesenc/aesdec latency.
+constexpr size_t lanes = 4;
+
+static void encrypt_blocks(block* data, size_t count,
+    const schedule& keys) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    for (; count >= lanes; count -= lanes, data += lanes)
+    {
+        auto a = _mm_xor_si128(load(data[0][0]), keys[0]);
+        auto b = _mm_xor_si128(load(data[1][0]), keys[0]);
+        auto c = _mm_xor_si128(load(data[2][0]), keys[0]);
+        auto d = _mm_xor_si128(load(data[3][0]), keys[0]);
+
+        for (size_t round = 1; round < rounds; ++round)
+        {
+            a = _mm_aesenc_si128(a, keys[round]);
+            b = _mm_aesenc_si128(b, keys[round]);
+            c = _mm_aesenc_si128(c, keys[round]);
+            d = _mm_aesenc_si128(d, keys[round]);
+        }
+
+        store(data[0][0], _mm_aesenclast_si128(a, keys[rounds]));
+        store(data[1][0], _mm_aesenclast_si128(b, keys[rounds]));
+        store(data[2][0], _mm_aesenclast_si128(c, keys[rounds]));
+        store(data[3][0], _mm_aesenclast_si128(d, keys[rounds]));
+    }
+
+    for (; !is_zero(count); --count, ++data)
+    {
+        auto a = _mm_xor_si128(load(data[0][0]), keys[0]);
+        for (size_t round = 1; round < rounds; ++round)
+            a = _mm_aesenc_si128(a, keys[round]);
+
+        store(data[0][0], _mm_aesenclast_si128(a, keys[rounds]));
+    }
+    BC_POP_WARNING()
+}
+
+static void decrypt_blocks(block* data, size_t count,
+    const schedule& keys) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    for (; count >= lanes; count -= lanes, data += lanes)
+    {
+        auto a = _mm_xor_si128(load(data[0][0]), keys[0]);
+        auto b = _mm_xor_si128(load(data[1][0]), keys[0]);
+        auto c = _mm_xor_si128(load(data[2][0]), keys[0]);
+        auto d = _mm_xor_si128(load(data[3][0]), keys[0]);
+
+        for (size_t round = 1; round < rounds; ++round)
+        {
+            a = _mm_aesdec_si128(a, keys[round]);
+            b = _mm_aesdec_si128(b, keys[round]);
+            c = _mm_aesdec_si128(c, keys[round]);
+            d = _mm_aesdec_si128(d, keys[round]);
+        }
+
+        store(data[0][0], _mm_aesdeclast_si128(a, keys[rounds]));
+        store(data[1][0], _mm_aesdeclast_si128(b, keys[rounds]));
+        store(data[2][0], _mm_aesdeclast_si128(c, keys[rounds]));
+        store(data[3][0], _mm_aesdeclast_si128(d, keys[rounds]));
+    }
+
+    for (; !is_zero(count); --count, ++data)
+    {
+        auto a = _mm_xor_si128(load(data[0][0]), keys[0]);
+        for (size_t round = 1; round < rounds; ++round)
+            a = _mm_aesdec_si128(a, keys[round]);
+
+        store(data[0][0], _mm_aesdeclast_si128(a, keys[rounds]));
+    }
+    BC_POP_WARNING()
+}
+
+#if defined(HAVE_VAES)
+
+// Two blocks per 256 bit lane, four lanes (eight blocks) per iteration.
+constexpr size_t vlanes = 8;
+
+INLINE __m256i load2(const uint8_t& bytes) NOEXCEPT
+{
+    return _mm256_loadu_si256(pointer_cast<const __m256i>(&bytes));
+}
+
+INLINE void store2(uint8_t& bytes, __m256i value) NOEXCEPT
+{
+    _mm256_storeu_si256(pointer_cast<__m256i>(&bytes), value);
+}
+
+template <bool Encrypt>
+static size_t vector_blocks(block* data, size_t count,
+    const schedule& keys) NOEXCEPT
+{
+    std_array<__m256i, add1(rounds)> wide{};
+    for (size_t round = 0; round <= rounds; ++round)
+        wide[round] = _mm256_broadcastsi128_si256(keys[round]);
+
+    const auto start = count;
+
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    for (; count >= vlanes; count -= vlanes, data += vlanes)
+    {
+        auto a = _mm256_xor_si256(load2(data[0][0]), wide[0]);
+        auto b = _mm256_xor_si256(load2(data[2][0]), wide[0]);
+        auto c = _mm256_xor_si256(load2(data[4][0]), wide[0]);
+        auto d = _mm256_xor_si256(load2(data[6][0]), wide[0]);
+
+        for (size_t round = 1; round < rounds; ++round)
+        {
+            if constexpr (Encrypt)
+            {
+                a = _mm256_aesenc_epi128(a, wide[round]);
+                b = _mm256_aesenc_epi128(b, wide[round]);
+                c = _mm256_aesenc_epi128(c, wide[round]);
+                d = _mm256_aesenc_epi128(d, wide[round]);
+            }
+            else
+            {
+                a = _mm256_aesdec_epi128(a, wide[round]);
+                b = _mm256_aesdec_epi128(b, wide[round]);
+                c = _mm256_aesdec_epi128(c, wide[round]);
+                d = _mm256_aesdec_epi128(d, wide[round]);
+            }
+        }
+
+        if constexpr (Encrypt)
+        {
+            store2(data[0][0], _mm256_aesenclast_epi128(a, wide[rounds]));
+            store2(data[2][0], _mm256_aesenclast_epi128(b, wide[rounds]));
+            store2(data[4][0], _mm256_aesenclast_epi128(c, wide[rounds]));
+            store2(data[6][0], _mm256_aesenclast_epi128(d, wide[rounds]));
+        }
+        else
+        {
+            store2(data[0][0], _mm256_aesdeclast_epi128(a, wide[rounds]));
+            store2(data[2][0], _mm256_aesdeclast_epi128(b, wide[rounds]));
+            store2(data[4][0], _mm256_aesdeclast_epi128(c, wide[rounds]));
+            store2(data[6][0], _mm256_aesdeclast_epi128(d, wide[rounds]));
+        }
+    }
+    BC_POP_WARNING()
+
+    return start - count;
+}
+
+#endif // HAVE_VAES
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+static void encrypt(block* data, size_t count, const secret& key) NOEXCEPT
+{
+    schedule keys{};
+    encryption_schedule(keys, key);
+
+#if defined(HAVE_VAES)
+    if (count >= vlanes && have_vaes())
+    {
+        const auto done = vector_blocks<true>(data, count, keys);
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        data += done;
+        BC_POP_WARNING()
+        count -= done;
+    }
+#endif
+
+    encrypt_blocks(data, count, keys);
+}
+
+static void decrypt(block* data, size_t count, const secret& key) NOEXCEPT
+{
+    schedule keys{};
+    decryption_schedule(keys, key);
+
+#if defined(HAVE_VAES)
+    if (count >= vlanes && have_vaes())
+    {
+        const auto done = vector_blocks<false>(data, count, keys);
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        data += done;
+        BC_POP_WARNING()
+        count -= done;
+    }
+#endif
+
+    decrypt_blocks(data, count, keys);
+}
+
+} // namespace native
+
+#endif // HAVE_AESNI
+
 ////constexpr void zeroize(aes256::context& context) NOEXCEPT
 ////{
 ////    context.key.fill(0);
@@ -395,6 +669,14 @@ constexpr void decrypt_block(aes256::context& context, block& bytes) NOEXCEPT
 
 void encrypt(block& bytes, const secret& key) NOEXCEPT
 {
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        native::encrypt(&bytes, one, key);
+        return;
+    }
+#endif
+
     aes256::context context;
     initialize(context, key);
     encrypt_block(context, bytes);
@@ -403,12 +685,60 @@ void encrypt(block& bytes, const secret& key) NOEXCEPT
 
 void decrypt(block& bytes, const secret& key) NOEXCEPT
 {
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        native::decrypt(&bytes, one, key);
+        return;
+    }
+#endif
+
     aes256::context context;
     initialize(context, key);
     decrypt_block(context, bytes);
     ////zeroize(context);
 }
 
+void encrypt(blocks& bytes, const secret& key) NOEXCEPT
+{
+    if (bytes.empty())
+        return;
+
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        native::encrypt(bytes.data(), bytes.size(), key);
+        return;
+    }
+#endif
+
+    aes256::context context;
+    initialize(context, key);
+    for (auto& block: bytes)
+        encrypt_block(context, block);
+    ////zeroize(context);
+}
+
+void decrypt(blocks& bytes, const secret& key) NOEXCEPT
+{
+    if (bytes.empty())
+        return;
+
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        native::decrypt(bytes.data(), bytes.size(), key);
+        return;
+    }
+#endif
+
+    aes256::context context;
+    initialize(context, key);
+    for (auto& block: bytes)
+        decrypt_block(context, block);
+    ////zeroize(context);
+}
+
 } // namespace aes256
 } // namespace system
 } // namespace libbitcoin
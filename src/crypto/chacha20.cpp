@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/crypto/chacha20.hpp>
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// datatracker.ietf.org/doc/html/rfc8439
+// cr.yp.to/chacha/chacha-20080128.pdf
+
+constexpr size_t rounds = 20;
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+template <size_t A, size_t B, size_t C, size_t D>
+INLINE constexpr void quarter(std_array<uint32_t, 16>& x) NOEXCEPT
+{
+    x[A] += x[B]; x[D] = rotl<16>(x[D] ^ x[A]);
+    x[C] += x[D]; x[B] = rotl<12>(x[B] ^ x[C]);
+    x[A] += x[B]; x[D] = rotl<8>(x[D] ^ x[A]);
+    x[C] += x[D]; x[B] = rotl<7>(x[B] ^ x[C]);
+}
+
+INLINE constexpr uint32_t load(const uint8_t* bytes) NOEXCEPT
+{
+    return bit_or(bit_or(wide_cast<uint32_t>(bytes[0]),
+        shift_left(wide_cast<uint32_t>(bytes[1]), 8)),
+        bit_or(shift_left(wide_cast<uint32_t>(bytes[2]), 16),
+            shift_left(wide_cast<uint32_t>(bytes[3]), 24)));
+}
+
+INLINE constexpr void store(uint8_t* bytes, uint32_t value) NOEXCEPT
+{
+    bytes[0] = narrow_cast<uint8_t>(value);
+    bytes[1] = narrow_cast<uint8_t>(shift_right(value, 8));
+    bytes[2] = narrow_cast<uint8_t>(shift_right(value, 16));
+    bytes[3] = narrow_cast<uint8_t>(shift_right(value, 24));
+}
+
+chacha20::chacha20(const secret& key, uint64_t nonce,
+    uint64_t counter) NOEXCEPT
+  : state_
+    {
+        // "expand 32-byte k"
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+        load(&key[0]), load(&key[4]), load(&key[8]), load(&key[12]),
+        load(&key[16]), load(&key[20]), load(&key[24]), load(&key[28]),
+        narrow_cast<uint32_t>(counter),
+        narrow_cast<uint32_t>(shift_right(counter, 32)),
+        narrow_cast<uint32_t>(nonce),
+        narrow_cast<uint32_t>(shift_right(nonce, 32))
+    }
+{
+}
+
+void chacha20::generate(block& out) NOEXCEPT
+{
+    next(out.data());
+}
+
+size_t chacha20::generate(const data_slab& out) NOEXCEPT
+{
+    const auto blocks = out.size() / block_size;
+    auto data = out.data();
+
+    for (size_t block = 0; block < blocks; ++block, data += block_size)
+        next(data);
+
+    return blocks * block_size;
+}
+
+// private
+void chacha20::next(uint8_t* out) NOEXCEPT
+{
+    auto x = state_;
+    for (size_t round = 0; round < rounds; round += two)
+    {
+        // Column rounds.
+        quarter<0, 4,  8, 12>(x);
+        quarter<1, 5,  9, 13>(x);
+        quarter<2, 6, 10, 14>(x);
+        quarter<3, 7, 11, 15>(x);
+
+        // Diagonal rounds.
+        quarter<0, 5, 10, 15>(x);
+        quarter<1, 6, 11, 12>(x);
+        quarter<2, 7,  8, 13>(x);
+        quarter<3, 4,  9, 14>(x);
+    }
+
+    for (size_t word = 0; word < x.size(); ++word)
+        store(&out[word * sizeof(uint32_t)], x[word] + state_[word]);
+
+    // 64 bit block counter (words 12 and 13).
+    if (is_zero(++state_[12]))
+        ++state_[13];
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
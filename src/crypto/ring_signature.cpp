@@ -26,13 +26,14 @@
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 #include <bitcoin/system/wallet/keys/hd_private.hpp>
-#include <bitcoin/system/wallet/keys/ec_point.hpp>
+#include <bitcoin/system/wallet/keys/ec_affine.hpp>
 #include <bitcoin/system/wallet/keys/ec_scalar.hpp>
 
 namespace libbitcoin {
 namespace system {
 
 typedef std::vector<uint32_t> index_list;
+typedef std::vector<affine_list> point_rings;
 typedef std::map<ec_compressed, ec_secret> secret_keys_map;
 
 static ec_scalar borromean_hash(const hash_digest& M, const data_slice& R,
@@ -138,17 +139,52 @@ static bool generate_known_indexes(index_list& out, const key_rings& rings,
     return !has_empty && create_key_indexes(out, rings, known_keys_by_ring);
 }
 
-static ec_point calculate_R(const ec_scalar& s, const ec_scalar& e,
-    const ec_point& P) NOEXCEPT
+// Ring ordinals, over which independent rings are processed concurrently.
+static index_list ring_indexes(size_t count) NOEXCEPT
 {
-    return s * ec_point::generator + e * P;
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    index_list indexes(count);
+    BC_POP_WARNING()
+
+    std::iota(indexes.begin(), indexes.end(), 0u);
+    return indexes;
+}
+
+// Parse each ring's public keys once, shared by all R calculations.
+// An unparseable key remains invalid and fails any calculation using it.
+static point_rings parse_rings(const key_rings& rings) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    point_rings points(rings.size());
+    BC_POP_WARNING()
+
+    std_transform(bc::par_unseq, rings.begin(), rings.end(), points.begin(),
+        [](const compressed_list& ring) NOEXCEPT
+        {
+            affine_list ring_points{};
+            ring_points.reserve(ring.size());
+
+            for (const auto& key: ring)
+                ring_points.emplace_back(key);
+
+            return ring_points;
+        });
+
+    return points;
+}
+
+// Points are held in parsed form, serialized only for hashing.
+static ec_affine calculate_R(const ec_scalar& s, const ec_scalar& e,
+    const ec_affine& P) NOEXCEPT
+{
+    return ec_affine::from_scalar(s) + e * P;
 }
 
-static ec_point calculate_last_R_signing(const compressed_list& ring,
+static ec_affine calculate_last_R_signing(const affine_list& ring,
     uint32_t i, const hash_digest& digest, const ring_signature& signature,
     const uint32_t known_key_index, const secret_list& salts) NOEXCEPT
 {
-    auto R_i_j = salts[i] * ec_point::generator;
+    auto R_i_j = ec_affine::from_scalar(salts[i]);
     if (!R_i_j)
         return {};
 
@@ -173,26 +209,32 @@ static ec_point calculate_last_R_signing(const compressed_list& ring,
     return R_i_j;
 }
 
-static bool calculate_e0(ring_signature& out, const key_rings& rings,
+static bool calculate_e0(ring_signature& out, const point_rings& rings,
     const hash_digest& digest, const secret_list& salts,
     const index_list& known_key_indexes) NOEXCEPT
 {
-    hash_digest hash;
-    hash::sha256::copy sink(hash);
-
     BC_ASSERT(known_key_indexes.size() == rings.size());
     BC_ASSERT(out.proofs.size() == rings.size());
     BC_ASSERT(salts.size() == rings.size());
 
-    for (uint32_t i = 0; i < rings.size(); ++i)
-    {
-        const auto& ring = rings[i];
-        const auto known_key_index = known_key_indexes[i];
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    affine_list last_Rs(rings.size());
+    BC_POP_WARNING()
 
-        // Calculate the last R value.
-        const auto last_R = calculate_last_R_signing(ring, i, digest, out,
-            known_key_index, salts);
+    // Calculate the last R value of each ring.
+    const auto indexes = ring_indexes(rings.size());
+    std_transform(bc::par_unseq, indexes.begin(), indexes.end(),
+        last_Rs.begin(), [&](uint32_t i) NOEXCEPT
+        {
+            return calculate_last_R_signing(rings[i], i, digest, out,
+                known_key_indexes[i], salts);
+        });
 
+    hash_digest hash;
+    hash::sha256::copy sink(hash);
+
+    for (const auto& last_R: last_Rs)
+    {
         if (!last_R)
             return false;
 
@@ -208,7 +250,7 @@ static bool calculate_e0(ring_signature& out, const key_rings& rings,
 }
 
 static bool calculate_e_at_known_key_index(ec_scalar& e_i_j,
-    const ring_signature& signature, const compressed_list& ring,
+    const ring_signature& signature, const affine_list& ring,
     const hash_digest& digest, const uint32_t i,
     const uint32_t known_key_index) NOEXCEPT
 {
@@ -235,51 +277,60 @@ static bool calculate_e_at_known_key_index(ec_scalar& e_i_j,
     return true;
 }
 
-static bool join_rings(ring_signature& out, const key_rings& rings,
-    const hash_digest& digest, const secret_list& salts,
-    const index_list& known_key_indexes, secret_keys_map& secret_keys) NOEXCEPT
+static bool join_ring(ring_signature& out, const compressed_list& ring,
+    const affine_list& points, const hash_digest& digest, uint32_t i,
+    const ec_secret& salt, uint32_t known_key_index,
+    const secret_keys_map& secret_keys) NOEXCEPT
 {
-    for (uint32_t i = 0; i < rings.size(); ++i)
-    {
-        const auto& ring = rings[i];
-        const auto known_key_index = known_key_indexes[i];
-
-        // Calculate starting e value of this current ring.
-        auto e_i_j = borromean_hash(digest, out.challenge, i, zero);
-        if (!e_i_j)
-            return false;
+    // Calculate starting e value of this current ring.
+    auto e_i_j = borromean_hash(digest, out.challenge, i, zero);
+    if (!e_i_j)
+        return false;
 
-        if (!calculate_e_at_known_key_index(e_i_j, out, ring, digest, i,
-            known_key_index))
-            return false;
+    if (!calculate_e_at_known_key_index(e_i_j, out, points, digest, i,
+        known_key_index))
+        return false;
 
-        // Find secret key used for calculation in the next step.
-        BC_ASSERT(known_key_index < ring.size());
-        const auto& known_public_key = ring[known_key_index];
+    // Find secret key used for calculation in the next step.
+    BC_ASSERT(known_key_index < ring.size());
+    const auto& known_public_key = ring[known_key_index];
 
-        BC_ASSERT(secret_keys.find(known_public_key) != secret_keys.end());
-        const auto& secret = secret_keys[known_public_key];
+    const auto secret = secret_keys.find(known_public_key);
+    BC_ASSERT(secret != secret_keys.end());
 
-        // Now close the ring using this calculation:
-        const auto& k = salts[i];
-        const auto& x = secret;
+    // Now close the ring using this calculation:
+    const auto& k = salt;
+    const auto& x = secret->second;
 
-        const auto s = k - e_i_j * x;
-        if (!s)
-            return false;
-
-        // Close the ring.
-        out.proofs[i][known_key_index] = s;
-    }
+    const auto s = k - e_i_j * x;
+    if (!s)
+        return false;
 
+    // Close the ring.
+    out.proofs[i][known_key_index] = s;
     return true;
 }
 
-static ec_point calculate_last_R_verify(const compressed_list& ring,
+// Each ring writes only its own proofs, so rings are joined concurrently.
+static bool join_rings(ring_signature& out, const key_rings& rings,
+    const point_rings& points, const hash_digest& digest,
+    const secret_list& salts, const index_list& known_key_indexes,
+    const secret_keys_map& secret_keys) NOEXCEPT
+{
+    const auto indexes = ring_indexes(rings.size());
+    return std_all_of(bc::par_unseq, indexes.begin(), indexes.end(),
+        [&](uint32_t i) NOEXCEPT
+        {
+            return join_ring(out, rings[i], points[i], digest, i, salts[i],
+                known_key_indexes[i], secret_keys);
+        });
+}
+
+static ec_affine calculate_last_R_verify(const affine_list& ring,
     ec_scalar e_i_j, uint32_t i, const hash_digest& digest,
     const ring_signature& signature) NOEXCEPT
 {
-    ec_point R_i_j;
+    ec_affine R_i_j;
     BC_ASSERT(signature.proofs[i].size() == ring.size());
 
     for (uint32_t j = 0; j < ring.size(); ++j)
@@ -338,11 +389,12 @@ bool sign(ring_signature& out, const secret_list& secrets,
     if (!generate_known_indexes(known_key_indexes, rings, secret_keys))
         return false;
 
-    if (!calculate_e0(out, rings, digest, salts, known_key_indexes))
+    const auto points = parse_rings(rings);
+    if (!calculate_e0(out, points, digest, salts, known_key_indexes))
         return false;
 
     // Join each ring at the index where the secret key is known.
-    return join_rings(out, rings, digest, salts, known_key_indexes,
+    return join_rings(out, rings, points, digest, salts, known_key_indexes,
         secret_keys);
 }
 
@@ -358,22 +410,34 @@ bool verify(const key_rings& rings, const hash_digest& digest,
     if (rings.size() >= max_uint32 || signature.proofs.size() != rings.size())
         return false;
 
+    const auto points = parse_rings(rings);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    affine_list last_Rs(rings.size());
+    BC_POP_WARNING()
+
+    // Calculate the last R value of each ring.
+    const auto indexes = ring_indexes(rings.size());
+    std_transform(bc::par_unseq, indexes.begin(), indexes.end(),
+        last_Rs.begin(), [&](uint32_t i) NOEXCEPT -> ec_affine
+        {
+            // Calculate first e value for this ring.
+            const auto e_i_0 = borromean_hash(digest, signature.challenge, i,
+                zero);
+
+            if (!e_i_0 || signature.proofs[i].size() != rings[i].size())
+                return {};
+
+            return calculate_last_R_verify(points[i], e_i_0, i, digest,
+                signature);
+        });
+
     // Hash data to produce e0 value.
     hash_digest hash;
     hash::sha256::copy sink(hash);
 
-    for (uint32_t i = 0; i < rings.size(); ++i)
+    for (const auto& last_R: last_Rs)
     {
-        // Calculate first e value for this ring.
-        const auto e_i_0 = borromean_hash(digest, signature.challenge, i, zero);
-
-        if (!e_i_0)
-            return false;
-
-        // Calculate the last R value.
-        const auto last_R = calculate_last_R_verify(rings[i], e_i_0, i, digest,
-            signature);
-
         if (!last_R)
             return false;
 
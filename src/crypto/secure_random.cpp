@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/crypto/secure_random.hpp>
+
+#include <algorithm>
+#include <random>
+#include <bitcoin/system/crypto/chacha20.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Keystream blocks buffered per refill (the first half block rekeys).
+constexpr size_t buffer_blocks = 16;
+constexpr size_t buffer_size = buffer_blocks * chacha20::block_size;
+constexpr size_t key_size = chacha20::secret_size;
+
+class generator
+{
+public:
+    DELETE_COPY_MOVE(generator);
+
+    // The calling thread's generator, keyed on first use.
+    static generator& local() NOEXCEPT
+    {
+        static thread_local generator instance{};
+        return instance;
+    }
+
+    generator() NOEXCEPT
+      : cipher_{ entropy() }, buffer_{}, position_{ buffer_size }
+    {
+    }
+
+    void fill(uint8_t* out, size_t size) NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        while (!is_zero(size))
+        {
+            // Bulk requests bypass the buffer, generator is then rekeyed.
+            if (position_ == buffer_size && size >= buffer_size)
+            {
+                const auto bytes = cipher_.generate({ out, out + size });
+                out += bytes;
+                size -= bytes;
+                refill();
+                continue;
+            }
+
+            if (position_ == buffer_size)
+                refill();
+
+            // Consumed keystream is cleared (not recoverable from state).
+            const auto bytes = std::min(size, buffer_size - position_);
+            const auto from = std::next(buffer_.begin(), position_);
+            std::copy_n(from, bytes, out);
+            std::fill_n(from, bytes, uint8_t{});
+            out += bytes;
+            size -= bytes;
+            position_ += bytes;
+        }
+        BC_POP_WARNING()
+        BC_POP_WARNING()
+    }
+
+    void reseed() NOEXCEPT
+    {
+        cipher_ = chacha20{ entropy() };
+        buffer_.fill(0);
+        position_ = buffer_size;
+    }
+
+private:
+    static chacha20::secret entropy() NOEXCEPT
+    {
+        // std::random_device is nondeterministic on all supported platforms
+        // (getrandom or /dev/urandom, rand_s on Windows).
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        std::random_device device{};
+        chacha20::secret key{};
+        for (auto it = key.begin(); it != key.end();)
+        {
+            auto word = device();
+            for (size_t byte = 0; byte < sizeof(word); ++byte, ++it)
+            {
+                *it = narrow_cast<uint8_t>(word);
+                word = shift_right(word, byte_bits);
+            }
+        }
+        BC_POP_WARNING()
+
+        return key;
+    }
+
+    // Fast key erasure: the first key_size bytes of each refill rekey.
+    void refill() NOEXCEPT
+    {
+        cipher_.generate(data_slab{ buffer_ });
+
+        chacha20::secret key{};
+        std::copy_n(buffer_.begin(), key_size, key.begin());
+        std::fill_n(buffer_.begin(), key_size, uint8_t{});
+        cipher_ = chacha20{ key };
+        position_ = key_size;
+    }
+
+    chacha20 cipher_;
+    data_array<buffer_size> buffer_;
+    size_t position_;
+};
+
+void secure_random::fill(const data_slab& out) NOEXCEPT
+{
+    generator::local().fill(out.data(), out.size());
+}
+
+uint64_t secure_random::next() NOEXCEPT
+{
+    data_array<sizeof(uint64_t)> bytes{};
+    fill(bytes);
+    return from_little_endian(bytes);
+}
+
+// Rejection sampling eliminates the modulo bias of a non-power-of-two range.
+uint64_t secure_random::next(uint64_t begin, uint64_t end) NOEXCEPT
+{
+    if (begin > end)
+        return {};
+
+    const auto range = end - begin;
+    if (range == max_uint64)
+        return next();
+
+    const auto size = add1(range);
+    const auto threshold = (max_uint64 - range) % size;
+
+    auto value = next();
+    while (value < threshold)
+        value = next();
+
+    return begin + (value % size);
+}
+
+void secure_random::reseed() NOEXCEPT
+{
+    generator::local().reseed();
+}
+
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/crypto/signature_cache.hpp>
+
+#include <atomic>
+#include <bitcoin/system/crypto/secure_random.hpp>
+#include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+static hash_digest random_salt() NOEXCEPT
+{
+    hash_digest salt{};
+    secure_random::fill(salt);
+    return salt;
+}
+
+signature_cache::signature_cache(size_t capacity, size_t kicks) NOEXCEPT
+  : signature_cache(capacity, kicks, random_salt())
+{
+}
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+signature_cache::signature_cache(size_t capacity, size_t kicks,
+    const hash_digest& salt) NOEXCEPT
+  : kicks_(kicks), salt_(salt), slots_(capacity)
+{
+}
+BC_POP_WARNING()
+
+bool signature_cache::verify(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    const auto value = key(point, hash, signature);
+    if (find(value))
+        return true;
+
+    if (!verify_signature(point, hash, signature))
+        return false;
+
+    store(value);
+    return true;
+}
+
+bool signature_cache::contains(const data_slice& point,
+    const hash_digest& hash, const ec_signature& signature) const NOEXCEPT
+{
+    return find(key(point, hash, signature));
+}
+
+void signature_cache::insert(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    store(key(point, hash, signature));
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+size_t signature_cache::capacity() const NOEXCEPT
+{
+    return slots_.size();
+}
+
+size_t signature_cache::kicks() const NOEXCEPT
+{
+    return kicks_;
+}
+
+size_t signature_cache::hits() const NOEXCEPT
+{
+    return hits_.load(std::memory_order_relaxed);
+}
+
+size_t signature_cache::misses() const NOEXCEPT
+{
+    return misses_.load(std::memory_order_relaxed);
+}
+
+size_t signature_cache::evictions() const NOEXCEPT
+{
+    return evictions_.load(std::memory_order_relaxed);
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+signature_cache::entry signature_cache::key(const data_slice& point,
+    const hash_digest& hash, const ec_signature& signature) const NOEXCEPT
+{
+    // sha256(salt || hash || signature || point)
+    const auto digest = sha256_hash(build_chunk(
+    {
+        salt_, hash, signature, point
+    }));
+
+    return
+    {
+        from_little_endian<uint64_t>(slice<0, 8>(digest)),
+        from_little_endian<uint64_t>(slice<8, 16>(digest)),
+        from_little_endian<uint64_t>(slice<16, 24>(digest)),
+        from_little_endian<uint64_t>(slice<24, 32>(digest))
+    };
+}
+
+bool signature_cache::find(const entry& value) const NOEXCEPT
+{
+    const auto hit = !slots_.empty() && is_cached(value);
+    (hit ? hits_ : misses_).fetch_add(one, std::memory_order_relaxed);
+    return hit;
+}
+
+void signature_cache::store(const entry& value) NOEXCEPT
+{
+    if (slots_.empty() || is_cached(value))
+        return;
+
+    auto current = value;
+    auto index = first(current);
+    for (size_t kick = 0;; ++kick)
+    {
+        const auto other = alternate(current, index);
+
+        if (is_vacant(index))
+        {
+            write(index, current);
+            return;
+        }
+
+        if (is_vacant(other))
+        {
+            write(other, current);
+            return;
+        }
+
+        // Evict the occupant once displacements are exhausted.
+        entry displaced{};
+        if (kick == kicks_ || !read(displaced, index))
+        {
+            if (write(index, current))
+                evictions_.fetch_add(one, std::memory_order_relaxed);
+
+            return;
+        }
+
+        // Contended slot, entry is dropped (cache miss).
+        if (!write(index, current))
+            return;
+
+        // Displace the occupant to its alternate slot.
+        current = displaced;
+        index = alternate(current, index);
+    }
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+size_t signature_cache::first(const entry& value) const NOEXCEPT
+{
+    return value.front() % slots_.size();
+}
+
+size_t signature_cache::second(const entry& value) const NOEXCEPT
+{
+    return value.back() % slots_.size();
+}
+
+size_t signature_cache::alternate(const entry& value,
+    size_t index) const NOEXCEPT
+{
+    return index == first(value) ? second(value) : first(value);
+}
+
+bool signature_cache::is_cached(const entry& value) const NOEXCEPT
+{
+    entry found{};
+    return (read(found, first(value)) && found == value)
+        || (read(found, second(value)) && found == value);
+}
+
+bool signature_cache::is_vacant(size_t index) const NOEXCEPT
+{
+    return is_zero(slots_[index].sequence.load(std::memory_order_relaxed));
+}
+
+// Sequence lock read, fails if vacant or written during the read.
+bool signature_cache::read(entry& out, size_t index) const NOEXCEPT
+{
+    const auto& slot = slots_[index];
+    const auto sequence = slot.sequence.load(std::memory_order_acquire);
+    if (is_zero(sequence) || is_odd(sequence))
+        return false;
+
+    for (size_t word = 0; word < out.size(); ++word)
+        out[word] = slot.words[word].load(std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+// Sequence lock write, fails if another writer holds the slot.
+bool signature_cache::write(size_t index, const entry& value) NOEXCEPT
+{
+    auto& slot = slots_[index];
+    auto sequence = slot.sequence.load(std::memory_order_relaxed);
+    if (is_odd(sequence) || !slot.sequence.compare_exchange_strong(sequence,
+        add1(sequence), std::memory_order_acquire))
+        return false;
+
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t word = 0; word < value.size(); ++word)
+        slot.words[word].store(value[word], std::memory_order_relaxed);
+
+    slot.sequence.store(sequence + 2u, std::memory_order_release);
+    return true;
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
@@ -71,50 +71,58 @@ bool verify_checksum(const data_chunk& data) NOEXCEPT
 static const size_t bech32_version_size = 1;
 static const size_t bech32_checksum_size = 6;
 
-static base32_chunk bech32_expand_prefix(const std::string& prefix) NOEXCEPT
-{
-    const auto size = prefix.size();
-    const auto lower = ascii_to_lower(prefix);
-    base32_chunk out(add1(2u * size), 0x00);
+static const size_t bech32_mask = 0x1f;
 
-    for (size_t index = 0; index < size; ++index)
+// Generator residues of the five high bits shifted out of each polymod step,
+// indexed by those bits (table-driven polymod).
+static CONSTEVAL std_array<uint32_t, 32> bech32_generators() NOEXCEPT
+{
+    constexpr std_array<uint32_t, 5> generators
     {
-        const char character = lower[index];
-        out[index] = character >> 5;
-        out[size + 1u + index] = character;
-    }
+        0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3
+    };
 
-    out[size] = 0x00;
-    return out;
+    std_array<uint32_t, 32> table{};
+    for (size_t coefficient = 0; coefficient < table.size(); ++coefficient)
+        for (size_t bit = 0; bit < generators.size(); ++bit)
+            if (get_right(coefficient, bit))
+                table.at(coefficient) ^= generators.at(bit);
+
+    return table;
 }
 
-static base32_chunk bech32_expand_checksum(uint32_t checksum) NOEXCEPT
+static constexpr auto bech32_table = bech32_generators();
+
+constexpr uint32_t bech32_step(uint32_t checksum, uint8_t value) NOEXCEPT
 {
-    base32_chunk out(bech32_checksum_size, 0x00);
-    out[0] = (checksum >> 25);
-    out[1] = (checksum >> 20);
-    out[2] = (checksum >> 15);
-    out[3] = (checksum >> 10);
-    out[4] = (checksum >> 5);
-    out[5] = (checksum >> 0);
-    return out;
+    BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+    return ((checksum & 0x01ffffff) << 5) ^ value ^
+        bech32_table[checksum >> 25];
+    BC_POP_WARNING()
 }
 
-static uint32_t bech32_checksum(const base32_chunk& data) NOEXCEPT
+// Checksum state after the expanded prefix, computed without expansion.
+static uint32_t bech32_prefix_checksum(const std::string& prefix) NOEXCEPT
 {
     uint32_t checksum = 1;
+    const auto lower = ascii_to_lower(prefix);
 
-    for (const auto& value: data)
-    {
-        const uint32_t coeficient = (checksum >> 25);
-        checksum = ((checksum & 0x01ffffff) << 5) ^ value.convert_to<uint8_t>();
+    for (const auto character: lower)
+        checksum = bech32_step(checksum, character >> 5);
+
+    checksum = bech32_step(checksum, 0x00);
 
-        if (coeficient & 0x01) checksum ^= 0x3b6a57b2;
-        if (coeficient & 0x02) checksum ^= 0x26508e6d;
-        if (coeficient & 0x04) checksum ^= 0x1ea119fa;
-        if (coeficient & 0x08) checksum ^= 0x3d4233dd;
-        if (coeficient & 0x10) checksum ^= 0x2a1462b3;
-    }
+    for (const auto character: lower)
+        checksum = bech32_step(checksum, character & bech32_mask);
+
+    return checksum;
+}
+
+static uint32_t bech32_checksum(uint32_t checksum,
+    const base32_chunk& data) NOEXCEPT
+{
+    for (const auto& value: data)
+        checksum = bech32_step(checksum, value.convert_to<uint8_t>());
 
     return checksum;
 }
@@ -126,30 +134,26 @@ constexpr uint32_t bech32_constant(uint8_t version) NOEXCEPT
     return is_zero(version) ? 0x00000001 : 0x2bc830a3;
 }
 
-static void bech32_prepend_prefix(base32_chunk& data,
-    const std::string& prefix) NOEXCEPT
-{
-    const auto expanded = bech32_expand_prefix(prefix);
-    data.insert(data.begin(), expanded.begin(), expanded.end());
-}
-
 static void bech32_append_checksum(base32_chunk& data,
     const std::string& prefix, uint8_t version) NOEXCEPT
 {
-    base32_chunk prefixed{ data };
-    bech32_prepend_prefix(prefixed, prefix);
-    prefixed.resize(prefixed.size() + bech32_checksum_size, 0x00);
-    const auto checksum = bech32_checksum(prefixed) ^ bech32_constant(version);
-    const auto checked = bech32_expand_checksum(checksum);
-    data.insert(data.end(), checked.begin(), checked.end());
+    auto checksum = bech32_checksum(bech32_prefix_checksum(prefix), data);
+
+    // Checksum positions are zero in the computation.
+    for (size_t count = 0; count < bech32_checksum_size; ++count)
+        checksum = bech32_step(checksum, 0x00);
+
+    checksum ^= bech32_constant(version);
+    for (auto shift = bech32_checksum_size; !is_zero(shift); --shift)
+        data.push_back(static_cast<uint5_t>(
+            (checksum >> (5u * sub1(shift))) & bech32_mask));
 }
 
 static bool bech32_verify_checksum(const base32_chunk& checked,
     const std::string& prefix, uint8_t version) NOEXCEPT
 {
-    base32_chunk prefixed{ checked };
-    bech32_prepend_prefix(prefixed, prefix);
-    return bech32_checksum(prefixed) == bech32_constant(version);
+    return bech32_checksum(bech32_prefix_checksum(prefix), checked) ==
+        bech32_constant(version);
 }
 
 base32_chunk bech32_build_checked(uint8_t version, const data_chunk& program,
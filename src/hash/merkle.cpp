@@ -0,0 +1,391 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/hash/merkle.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/algorithms.hpp>
+#include <bitcoin/system/hash/functions.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Vector allocation aborts.
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Node count at height (zero is leaves) for the given leaf count.
+static size_t width(size_t leaves, size_t height) NOEXCEPT
+{
+    return ceilinged_divide(leaves, power2<size_t>(height));
+}
+
+static size_t tree_depth(size_t leaves) NOEXCEPT
+{
+    auto height = zero;
+    while (width(leaves, height) > one)
+        ++height;
+
+    return height;
+}
+
+// The index may not exceed the positions addressed by the branch.
+static bool is_position(const merkle_tree::proof& proof) NOEXCEPT
+{
+    return proof.branch.size() < bits<size_t> &&
+        is_zero(proof.index >> proof.branch.size());
+}
+
+// static
+// ----------------------------------------------------------------------------
+
+hash_digest merkle_tree::root(const hash_digest& leaf,
+    const proof& proof) NOEXCEPT
+{
+    auto node = leaf;
+    auto position = proof.index;
+
+    for (const auto& sibling: proof.branch)
+    {
+        node = is_odd(position) ? sha256::double_hash(sibling, node) :
+            sha256::double_hash(node, sibling);
+
+        position >>= one;
+    }
+
+    return node;
+}
+
+bool merkle_tree::verify(const hash_digest& root, const hash_digest& leaf,
+    const proof& proof) NOEXCEPT
+{
+    return is_position(proof) && merkle_tree::root(leaf, proof) == root;
+}
+
+bool merkle_tree::verify(const hash_digest& root, const hashes& leaves,
+    const proofs& proofs) NOEXCEPT
+{
+    if (leaves.empty() || leaves.size() != proofs.size() ||
+        !std::all_of(proofs.begin(), proofs.end(), is_position))
+        return false;
+
+    const auto longest = std::max_element(proofs.begin(), proofs.end(),
+        [](const proof& left, const proof& right) NOEXCEPT
+        {
+            return left.branch.size() < right.branch.size();
+        })->branch.size();
+
+    auto nodes = leaves;
+    hashes pairs{};
+    pairs.reserve(two * nodes.size());
+
+    // Each level of all proofs is hashed as one merkle_hash (vectorized).
+    for (auto level = zero; level < longest; ++level)
+    {
+        pairs.clear();
+        for (auto index = zero; index < nodes.size(); ++index)
+        {
+            const auto& proof = proofs[index];
+            if (level >= proof.branch.size())
+                continue;
+
+            const auto& sibling = proof.branch[level];
+            const auto right = is_odd(proof.index >> level);
+            pairs.push_back(right ? sibling : nodes[index]);
+            pairs.push_back(right ? nodes[index] : sibling);
+        }
+
+        sha256::merkle_hash(pairs);
+
+        auto pair = pairs.begin();
+        for (auto index = zero; index < nodes.size(); ++index)
+            if (level < proofs[index].branch.size())
+                nodes[index] = *pair++;
+    }
+
+    return std::all_of(nodes.begin(), nodes.end(),
+        [&](const hash_digest& node) NOEXCEPT
+        {
+            return node == root;
+        });
+}
+
+// Partial tree extraction (bip37).
+class partial_extractor
+{
+public:
+    partial_extractor(const merkle_tree::partial& tree, hashes& matches,
+        std::vector<size_t>& indexes) NOEXCEPT
+      : tree_(tree), matches_(matches), indexes_(indexes)
+    {
+    }
+
+    bool extract(hash_digest& out) NOEXCEPT
+    {
+        out = extract(tree_depth(tree_.leaves), zero);
+
+        // All nodes consumed, flags consumed up to byte padding.
+        return !bad_ && hashed_ == tree_.nodes.size() &&
+            ceilinged_divide(flagged_, byte_bits) ==
+            ceilinged_divide(tree_.flags.size(), byte_bits);
+    }
+
+private:
+    hash_digest extract(size_t height, size_t position) NOEXCEPT
+    {
+        if (bad_ || flagged_ == tree_.flags.size())
+        {
+            bad_ = true;
+            return {};
+        }
+
+        const auto parent = tree_.flags[flagged_++];
+        if (is_zero(height) || !parent)
+        {
+            if (hashed_ == tree_.nodes.size())
+            {
+                bad_ = true;
+                return {};
+            }
+
+            const auto& node = tree_.nodes[hashed_++];
+            if (is_zero(height) && parent)
+            {
+                matches_.push_back(node);
+                indexes_.push_back(position);
+            }
+
+            return node;
+        }
+
+        const auto left = extract(sub1(height), position * two);
+        if (add1(position * two) >= width(tree_.leaves, sub1(height)))
+            return sha256::double_hash(left, left);
+
+        // Identical siblings would admit a duplicated subtree (CVE-2012-2459).
+        const auto right = extract(sub1(height), add1(position * two));
+        if (right == left)
+            bad_ = true;
+
+        return sha256::double_hash(left, right);
+    }
+
+    const merkle_tree::partial& tree_;
+    hashes& matches_;
+    std::vector<size_t>& indexes_;
+    size_t flagged_{};
+    size_t hashed_{};
+    bool bad_{};
+};
+
+bool merkle_tree::verify(const hash_digest& root, const partial& tree,
+    hashes& matches, std::vector<size_t>& indexes) NOEXCEPT
+{
+    matches.clear();
+    indexes.clear();
+
+    if (is_zero(tree.leaves) || tree.nodes.size() > tree.leaves ||
+        tree.flags.size() < tree.nodes.size())
+        return false;
+
+    hash_digest out{};
+    partial_extractor extractor{ tree, matches, indexes };
+    return extractor.extract(out) && out == root;
+}
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+merkle_tree::merkle_tree(hashes&& leaves) NOEXCEPT
+  : nodes_(std::move(leaves)), levels_(), leaves_(nodes_.size())
+{
+    build();
+}
+
+merkle_tree::merkle_tree(const hashes& leaves) NOEXCEPT
+  : nodes_(leaves), levels_(), leaves_(nodes_.size())
+{
+    build();
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+hash_digest merkle_tree::root() const NOEXCEPT
+{
+    return is_zero(leaves_) ? null_hash : nodes_.back();
+}
+
+size_t merkle_tree::leaves() const NOEXCEPT
+{
+    return leaves_;
+}
+
+size_t merkle_tree::depth() const NOEXCEPT
+{
+    return sub1(levels_.size());
+}
+
+// Methods.
+// ----------------------------------------------------------------------------
+
+merkle_tree::proof merkle_tree::prove(size_t index) const NOEXCEPT
+{
+    if (index >= leaves_)
+        return { index, {} };
+
+    proof out{ index, {} };
+    out.branch.reserve(depth());
+
+    // The last node of an odd level is paired with itself.
+    for (auto height = zero; height < depth(); ++height)
+    {
+        const auto sibling = bit_xor<size_t>(index, one);
+        out.branch.push_back(node(height,
+            sibling < width(leaves_, height) ? sibling : index));
+
+        index >>= one;
+    }
+
+    return out;
+}
+
+merkle_tree::proofs merkle_tree::prove(
+    const std::vector<size_t>& indexes) const NOEXCEPT
+{
+    proofs out(indexes.size());
+    std_transform(bc::par_unseq, indexes.begin(), indexes.end(), out.begin(),
+        [this](size_t index) NOEXCEPT
+        {
+            return prove(index);
+        });
+
+    return out;
+}
+
+bool merkle_tree::prove(proofs& out, const hashes& leaves) const NOEXCEPT
+{
+    std::unordered_map<hash_digest, size_t> positions{};
+    positions.reserve(leaves_);
+    for (auto index = zero; index < leaves_; ++index)
+        positions.emplace(nodes_[index], index);
+
+    std::vector<size_t> indexes{};
+    indexes.reserve(leaves.size());
+    for (const auto& leaf: leaves)
+    {
+        const auto position = positions.find(leaf);
+        if (position == positions.end())
+            return false;
+
+        indexes.push_back(position->second);
+    }
+
+    out = prove(indexes);
+    return true;
+}
+
+merkle_tree::partial merkle_tree::prune(
+    const std::vector<bool>& matches) const NOEXCEPT
+{
+    partial out{ leaves_, {}, {} };
+    if (!is_zero(leaves_))
+        traverse(out, matches, depth(), zero);
+
+    return out;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+const hash_digest& merkle_tree::node(size_t height,
+    size_t position) const NOEXCEPT
+{
+    BC_ASSERT(height < levels_.size());
+    BC_ASSERT(position < width(leaves_, height));
+    return nodes_[levels_[height] + position];
+}
+
+// Levels are appended to the leaves, the array is allocated once.
+void merkle_tree::build() NOEXCEPT
+{
+    levels_.push_back(zero);
+    if (is_zero(leaves_))
+        return;
+
+    const auto top = tree_depth(leaves_);
+    auto total = zero;
+    for (auto level = zero; level <= top; ++level)
+        total += width(leaves_, level);
+
+    nodes_.reserve(total);
+    levels_.reserve(add1(top));
+
+    hashes level{};
+    level.reserve(add1(leaves_));
+
+    for (auto height = zero; height < top; ++height)
+    {
+        const auto begin = std::next(nodes_.begin(), levels_.back());
+        level.assign(begin, std::next(begin, width(leaves_, height)));
+
+        if (is_odd(level.size()))
+            level.push_back(level.back());
+
+        sha256::merkle_hash(level);
+        levels_.push_back(nodes_.size());
+        nodes_.insert(nodes_.end(), level.begin(), level.end());
+    }
+}
+
+// Depth first, flagging nodes that are matches or parents of matches (bip37).
+void merkle_tree::traverse(partial& out, const std::vector<bool>& matches,
+    size_t height, size_t position) const NOEXCEPT
+{
+    const auto first = position << height;
+    const auto last = std::min(matches.size(),
+        std::min(add1(position) << height, leaves_));
+
+    auto parent = false;
+    for (auto index = first; !parent && index < last; ++index)
+        parent = matches[index];
+
+    out.flags.push_back(parent);
+    if (is_zero(height) || !parent)
+    {
+        out.nodes.push_back(node(height, position));
+        return;
+    }
+
+    traverse(out, matches, sub1(height), position * two);
+    if (add1(position * two) < width(leaves_, sub1(height)))
+        traverse(out, matches, sub1(height), add1(position * two));
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/machine/verification_cache.hpp>
+
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+static hash_digest random_salt() NOEXCEPT
+{
+    hash_digest salt{};
+    secure_random::fill(salt);
+    return salt;
+}
+
+// Lock discipline: shared for lookup, unique for mutation.
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+verification_cache::verification_cache(size_t capacity) NOEXCEPT
+  : verification_cache(capacity, random_salt())
+{
+}
+
+verification_cache::verification_cache(size_t capacity,
+    const hash_digest& salt) NOEXCEPT
+  : capacity_(capacity), salt_(salt)
+{
+    order_.reserve(capacity_);
+    keys_.reserve(capacity_);
+}
+
+bool verification_cache::contains(const hash_digest& witness_hash,
+    uint32_t index, uint32_t forks) const NOEXCEPT
+{
+    const auto entry = key(witness_hash, index, forks);
+
+    std::shared_lock lock(mutex_);
+    const auto found = keys_.contains(entry);
+    lock.unlock();
+
+    ++(found ? hits_ : misses_);
+    return found;
+}
+
+void verification_cache::insert(const hash_digest& witness_hash,
+    uint32_t index, uint32_t forks) NOEXCEPT
+{
+    if (is_zero(capacity_))
+        return;
+
+    const auto entry = key(witness_hash, index, forks);
+    std::unique_lock lock(mutex_);
+
+    if (!keys_.insert(entry).second)
+        return;
+
+    // Fill, then overwrite the oldest entry (ring order).
+    if (order_.size() < capacity_)
+    {
+        order_.push_back(entry);
+        return;
+    }
+
+    BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+    auto& oldest = order_[next_];
+    BC_POP_WARNING()
+
+    keys_.erase(oldest);
+    oldest = entry;
+    next_ = (add1(next_) == capacity_) ? zero : add1(next_);
+}
+
+void verification_cache::clear() NOEXCEPT
+{
+    std::unique_lock lock(mutex_);
+    next_ = zero;
+    order_.clear();
+    keys_.clear();
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+size_t verification_cache::size() const NOEXCEPT
+{
+    std::shared_lock lock(mutex_);
+    return keys_.size();
+}
+
+size_t verification_cache::capacity() const NOEXCEPT
+{
+    return capacity_;
+}
+
+size_t verification_cache::hits() const NOEXCEPT
+{
+    return hits_.load();
+}
+
+size_t verification_cache::misses() const NOEXCEPT
+{
+    return misses_.load();
+}
+
+BC_POP_WARNING()
+
+// protected
+// ----------------------------------------------------------------------------
+
+hash_digest verification_cache::key(const hash_digest& witness_hash,
+    uint32_t index, uint32_t forks) const NOEXCEPT
+{
+    // sha256(salt || wtxid || index || forks)
+    return sha256_hash(splice(salt_, witness_hash,
+        splice(to_little_endian(index), to_little_endian(forks))));
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// Keys are salted hashes, so any eight bytes are uniformly distributed.
+size_t verification_cache::key_hash::operator()(
+    const hash_digest& key) const NOEXCEPT
+{
+    return from_little_endian<size_t>(key);
+}
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/radix/base_16.hpp>
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
+
+// Vectorized base16 conversion of whole blocks, selected at runtime.
+// Encoding maps each nibble to its character by byte shuffle (pshufb) and
+// interleaves high and low nibble characters. Decoding validates and maps
+// each character to its nibble with signed byte compares (validation is fused
+// into conversion), then combines nibble pairs by multiply-add (pmaddubsw).
+// Blocks are 16 bytes (32 characters) for SSE4.1 and 32 bytes for AVX2.
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+
+#if defined(HAVE_AVX2)
+
+static size_t encode_x256(char* out, const uint8_t* in, size_t size) NOEXCEPT
+{
+    constexpr size_t block = sizeof(__m256i);
+    const auto mask = _mm256_set1_epi8(0x0f);
+    const auto digits = _mm256_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+    size_t position{};
+    for (; position + block <= size; position += block)
+    {
+        const auto bytes = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(in + position));
+
+        const auto high = _mm256_shuffle_epi8(digits,
+            _mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+        const auto low = _mm256_shuffle_epi8(digits,
+            _mm256_and_si256(bytes, mask));
+
+        // Unpack interleaves within 128 bit lanes, permute restores order.
+        const auto first = _mm256_unpacklo_epi8(high, low);
+        const auto second = _mm256_unpackhi_epi8(high, low);
+        const auto target = out + position * octet_width;
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target),
+            _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + block),
+            _mm256_permute2x128_si256(first, second, 0x31));
+    }
+
+    return position;
+}
+
+// Nibble values of characters, all ones in invalid lanes of the mask.
+static __m256i nibbles_x256(__m256i characters, __m256i& invalid) NOEXCEPT
+{
+    const auto lower = _mm256_or_si256(characters, _mm256_set1_epi8(0x20));
+    const auto digit = _mm256_and_si256(
+        _mm256_cmpgt_epi8(characters, _mm256_set1_epi8('0' - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), characters));
+    const auto alpha = _mm256_and_si256(
+        _mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+
+    invalid = _mm256_or_si256(invalid,
+        _mm256_xor_si256(_mm256_or_si256(digit, alpha), _mm256_set1_epi8(-1)));
+
+    return _mm256_or_si256(
+        _mm256_and_si256(digit,
+            _mm256_sub_epi8(characters, _mm256_set1_epi8('0'))),
+        _mm256_and_si256(alpha,
+            _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10))));
+}
+
+static bool decode_x256(size_t& converted, uint8_t* out, const char* in,
+    size_t size) NOEXCEPT
+{
+    constexpr size_t block = sizeof(__m256i);
+    const auto weights = _mm256_set1_epi16(0x0110);
+    auto invalid = _mm256_setzero_si256();
+
+    size_t position{};
+    for (; position + block <= size; position += block)
+    {
+        const auto source = in + position * octet_width;
+        const auto first = nibbles_x256(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(source)), invalid);
+        const auto second = nibbles_x256(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(source + block)), invalid);
+
+        // (high * 16 + low) for each nibble pair, packed within 128 bit
+        // lanes, with 64 bit permute to restore order.
+        const auto packed = _mm256_packus_epi16(
+            _mm256_maddubs_epi16(first, weights),
+            _mm256_maddubs_epi16(second, weights));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + position),
+            _mm256_permute4x64_epi64(packed, 0xd8));
+    }
+
+    converted = position;
+    return is_zero(_mm256_movemask_epi8(invalid));
+}
+
+#endif // HAVE_AVX2
+
+#if defined(HAVE_SSE4)
+
+static size_t encode_x128(char* out, const uint8_t* in, size_t size) NOEXCEPT
+{
+    constexpr size_t block = sizeof(__m128i);
+    const auto mask = _mm_set1_epi8(0x0f);
+    const auto digits = _mm_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+    size_t position{};
+    for (; position + block <= size; position += block)
+    {
+        const auto bytes = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(in + position));
+
+        const auto high = _mm_shuffle_epi8(digits,
+            _mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+        const auto low = _mm_shuffle_epi8(digits,
+            _mm_and_si128(bytes, mask));
+
+        const auto target = out + position * octet_width;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target),
+            _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target + block),
+            _mm_unpackhi_epi8(high, low));
+    }
+
+    return position;
+}
+
+// Nibble values of characters, all ones in invalid lanes of the mask.
+static __m128i nibbles_x128(__m128i characters, __m128i& invalid) NOEXCEPT
+{
+    const auto lower = _mm_or_si128(characters, _mm_set1_epi8(0x20));
+    const auto digit = _mm_and_si128(
+        _mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)),
+        _mm_cmplt_epi8(characters, _mm_set1_epi8('9' + 1)));
+    const auto alpha = _mm_and_si128(
+        _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+        _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+    invalid = _mm_or_si128(invalid,
+        _mm_xor_si128(_mm_or_si128(digit, alpha), _mm_set1_epi8(-1)));
+
+    return _mm_or_si128(
+        _mm_and_si128(digit, _mm_sub_epi8(characters, _mm_set1_epi8('0'))),
+        _mm_and_si128(alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+}
+
+static bool decode_x128(size_t& converted, uint8_t* out, const char* in,
+    size_t size) NOEXCEPT
+{
+    constexpr size_t block = sizeof(__m128i);
+    const auto weights = _mm_set1_epi16(0x0110);
+    auto invalid = _mm_setzero_si128();
+
+    size_t position{};
+    for (; position + block <= size; position += block)
+    {
+        const auto source = in + position * octet_width;
+        const auto first = nibbles_x128(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(source)), invalid);
+        const auto second = nibbles_x128(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(source + block)), invalid);
+
+        // (high * 16 + low) for each nibble pair.
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + position),
+            _mm_packus_epi16(
+                _mm_maddubs_epi16(first, weights),
+                _mm_maddubs_epi16(second, weights)));
+    }
+
+    converted = position;
+    return is_zero(_mm_movemask_epi8(invalid));
+}
+
+#endif // HAVE_SSE4
+
+#if defined(HAVE_AVX2) || defined(HAVE_SSE4)
+
+size_t encode_base16_vectorized(char* out, const uint8_t* in,
+    size_t size) NOEXCEPT
+{
+    size_t converted{};
+
+#if defined(HAVE_AVX2)
+    if (have_avx2())
+        converted = encode_x256(out, in, size);
+#endif
+
+#if defined(HAVE_SSE4)
+    if (have_sse41())
+        converted += encode_x128(out + converted * octet_width,
+            in + converted, size - converted);
+#endif
+
+    return converted;
+}
+
+bool decode_base16_vectorized(size_t& converted, uint8_t* out, const char* in,
+    size_t size) NOEXCEPT
+{
+    converted = zero;
+
+#if defined(HAVE_AVX2)
+    if (have_avx2() && !decode_x256(converted, out, in, size))
+        return false;
+#endif
+
+#if defined(HAVE_SSE4)
+    size_t remaining{};
+    if (have_sse41() && !decode_x128(remaining, out + converted,
+        in + converted * octet_width, size - converted))
+        return false;
+
+    converted += remaining;
+#endif
+
+    return true;
+}
+
+#else
+
+size_t encode_base16_vectorized(char*, const uint8_t*, size_t) NOEXCEPT
+{
+    return zero;
+}
+
+bool decode_base16_vectorized(size_t& converted, uint8_t*, const char*,
+    size_t) NOEXCEPT
+{
+    converted = zero;
+    return true;
+}
+
+#endif // HAVE_AVX2 || HAVE_SSE4
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
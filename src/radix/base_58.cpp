@@ -19,11 +19,20 @@
 #include <bitcoin/system/radix/base_58.hpp>
 
 #include <algorithm>
+#include <string>
+#include <vector>
+#include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
 
 // base58
 // Base 58 is an ascii data encoding with a domain of 58 symbols (characters).
 // 58 is not a power of 2 so base58 is not a bit mapping.
+// Conversion is by big number radix change, which is quadratic in length. The
+// number is held in word-sized limbs (58^5 for encoding, 2^32 for decoding) so
+// that each multiply-add pass over the limbs consumes five digits or four
+// bytes, using 64 bit arithmetic. Limbs are held on the stack for common sizes
+// (25 byte addresses, 78/82 byte extended keys), allocated otherwise.
 
 namespace libbitcoin {
 namespace system {
@@ -48,146 +57,273 @@ bool is_base58(const std::string& text) NOEXCEPT
     return std::all_of(text.begin(), text.end(), test);
 }
 
-template <typename Data>
-static auto find_first_nonzero(const Data& data) NOEXCEPT ->
-    decltype(data.cbegin())
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Limb sizing.
+// ----------------------------------------------------------------------------
+
+// 58^5 is the largest power of 58 within 32 bits.
+constexpr size_t limb_digits = 5;
+constexpr uint64_t limb_base58 = 58u * 58u * 58u * 58u * 58u;
+constexpr size_t limb_bytes = sizeof(uint32_t);
+
+// Encoded limbs for bytes: log(256) / log(58^5) = 0.2731, rounded up.
+constexpr size_t encoded_limbs(size_t bytes) NOEXCEPT
 {
-    auto first_nonzero = data.cbegin();
-    while (first_nonzero != data.end() && is_zero(*first_nonzero))
-        ++first_nonzero;
+    return add1(bytes * 2732_size / 10000_size);
+}
 
-    return first_nonzero;
+// Decoded limbs for characters: log(58) / log(2^32) = 0.1831, rounded up.
+constexpr size_t decoded_limbs(size_t characters) NOEXCEPT
+{
+    return add1(characters * 1831_size / 10000_size);
 }
 
-size_t count_leading_zeros(const data_slice& unencoded) NOEXCEPT
+// Stack limbs are used for input up to this size (bytes or characters).
+constexpr size_t stack_limit = 128;
+
+// Character to digit value, 0xff for non-base58 characters.
+static CONSTEVAL std_array<uint8_t, 128> base58_values() NOEXCEPT
 {
-    // Skip and count leading '1's.
-    size_t leading_zeros = 0;
-    for (const auto byte: unencoded)
+    constexpr std::string_view characters
     {
-        if (!is_zero(byte))
-            break;
+        "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz"
+    };
 
-        ++leading_zeros;
+    std_array<uint8_t, 128> values{};
+    values.fill(max_uint8);
+    for (size_t digit = 0; digit < characters.size(); ++digit)
+        values.at(characters.at(digit)) = narrow_cast<uint8_t>(digit);
+
+    return values;
+}
+
+static constexpr auto base58_value = base58_values();
+
+// Big number (little-endian limbs) multiply-add.
+// ----------------------------------------------------------------------------
+
+// Limbs are less than 58^5 (< 2^30) and multiplier at most 2^32, no overflow.
+template <typename Limbs>
+INLINE void multiply_add58(Limbs& limbs, size_t& used, uint64_t multiplier,
+    uint64_t carry) NOEXCEPT
+{
+    for (size_t limb = 0; limb < used; ++limb)
+    {
+        carry += limbs[limb] * multiplier;
+        limbs[limb] = narrow_cast<uint32_t>(carry % limb_base58);
+        carry /= limb_base58;
     }
 
-    return leading_zeros;
+    for (; !is_zero(carry); carry /= limb_base58)
+        limbs[used++] = narrow_cast<uint32_t>(carry % limb_base58);
 }
 
-void pack_value(data_chunk& indexes, size_t carry) NOEXCEPT
+// Limbs are less than 2^32 and multiplier at most 58^5, no overflow.
+template <typename Limbs>
+INLINE void multiply_add256(Limbs& limbs, size_t& used, uint64_t multiplier,
+    uint64_t carry) NOEXCEPT
 {
-    // Apply "b58 = b58 * 256 + ch".
-    for (auto it = indexes.rbegin(); it != indexes.rend(); ++it)
+    for (size_t limb = 0; limb < used; ++limb)
     {
-        carry += 256_size * (*it);
-        *it = carry % 58_size;
-        carry /= 58_size;
+        carry += limbs[limb] * multiplier;
+        limbs[limb] = narrow_cast<uint32_t>(carry);
+        carry >>= bits<uint32_t>;
     }
 
-    BC_ASSERT(is_zero(carry));
+    for (; !is_zero(carry); carry >>= bits<uint32_t>)
+        limbs[used++] = narrow_cast<uint32_t>(carry);
 }
 
-std::string encode_base58(const data_slice& unencoded) NOEXCEPT
+// Encode.
+// ----------------------------------------------------------------------------
+
+template <typename Limbs>
+static std::string encode(Limbs& limbs, const data_slice& unencoded) NOEXCEPT
 {
-    const auto leading_zeros = count_leading_zeros(unencoded);
+    const auto size = unencoded.size();
+    const auto data = unencoded.data();
 
-    // size = log(256) / log(58), rounded up.
-    const auto number_nonzero = unencoded.size() - leading_zeros;
-    const auto indexes_size = add1(number_nonzero * 138_size / 100_size);
+    // Each leading zero byte is encoded as a leading '1'.
+    size_t leading = zero;
+    while (leading < size && is_zero(data[leading]))
+        ++leading;
 
-    // Allocate enough space in big-endian base58 representation.
-    data_chunk indexes(indexes_size);
+    // Consume a partial word first, then whole (big-endian) words.
+    size_t used = zero;
+    auto position = leading;
+    const auto partial = (size - leading) % limb_bytes;
 
-    // Process the bytes.
-    for (size_t index = leading_zeros; index < unencoded.size(); ++index)
-        pack_value(indexes, unencoded[index]);
+    if (!is_zero(partial))
+    {
+        uint64_t word = zero;
+        for (; position < leading + partial; ++position)
+            word = (word << byte_bits) | data[position];
 
-    // Skip leading zeros in base58 result.
-    auto it = find_first_nonzero(indexes);
+        multiply_add58(limbs, used, power2<uint64_t>(to_bits(partial)), word);
+    }
 
-    // Translate the result into a string.
-    std::string encoded;
-    const size_t estimated_size = leading_zeros + (indexes.end() - it);
-    encoded.reserve(estimated_size);
-    encoded.assign(leading_zeros, '1');
+    for (; position < size; position += limb_bytes)
+    {
+        const uint64_t word =
+            (uint64_t{ data[position + 0] } << 24) |
+            (uint64_t{ data[position + 1] } << 16) |
+            (uint64_t{ data[position + 2] } <<  8) |
+            (uint64_t{ data[position + 3] } <<  0);
+
+        multiply_add58(limbs, used, power2<uint64_t>(bits<uint32_t>), word);
+    }
 
-    // Set actual main bytes.
-    for (; it != indexes.end(); ++it)
+    // Expand limbs to digits, from the least significant, into the tail.
+    std::string encoded(leading + used * limb_digits, base58_chars.front());
+    auto digit = encoded.size();
+    for (size_t limb = 0; limb < used; ++limb)
     {
-        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
-        BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
-        encoded += base58_chars[*it];
-        BC_POP_WARNING()
-        BC_POP_WARNING()
+        auto value = limbs[limb];
+        for (size_t count = 0; count < limb_digits; ++count)
+        {
+            encoded[--digit] = base58_chars[value % 58u];
+            value /= 58u;
+        }
     }
 
+    // Remove zero digits of the most significant limb (at most four).
+    auto first = leading;
+    while (first < encoded.size() && encoded[first] == base58_chars.front())
+        ++first;
+
+    encoded.erase(leading, first - leading);
     return encoded;
 }
 
-size_t count_leading_zeros(const std::string& encoded) NOEXCEPT
+template <size_t Size>
+static std::string encode_fixed(const data_slice& unencoded) NOEXCEPT
+{
+    std_array<uint32_t, encoded_limbs(Size)> limbs;
+    return encode(limbs, unencoded);
+}
+
+std::string encode_base58(const data_slice& unencoded) NOEXCEPT
+{
+    switch (unencoded.size())
+    {
+        // Checked payment address (version, short hash, checksum).
+        case 25:
+            return encode_fixed<25>(unencoded);
+
+        // Extended key, unchecked and checked.
+        case 78:
+            return encode_fixed<78>(unencoded);
+        case 82:
+            return encode_fixed<82>(unencoded);
+
+        default:
+        {
+            if (unencoded.size() <= stack_limit)
+                return encode_fixed<stack_limit>(unencoded);
+
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            std::vector<uint32_t> limbs(encoded_limbs(unencoded.size()));
+            BC_POP_WARNING()
+
+            return encode(limbs, unencoded);
+        }
+    }
+}
+
+// Decode.
+// ----------------------------------------------------------------------------
+
+template <typename Limbs>
+static bool decode(Limbs& limbs, data_chunk& out,
+    const std::string& in) NOEXCEPT
 {
-    // Skip and count leading '1's.
-    auto leading_zeros = zero;
-    for (const auto digit: encoded)
+    const auto size = in.size();
+
+    // Each leading '1' is decoded as a leading zero byte.
+    size_t leading = zero;
+    while (leading < size && in[leading] == base58_chars.front())
+        ++leading;
+
+    // Consume a partial group of digits first, then whole groups.
+    size_t used = zero;
+    auto position = leading;
+    auto group = (size - leading) % limb_digits;
+    if (is_zero(group))
+        group = limb_digits;
+
+    for (uint64_t multiplier = power<uint64_t>(58u, group); position < size;
+        multiplier = limb_base58, group = limb_digits)
     {
-        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
-        if (digit != base58_chars[0])
-        BC_POP_WARNING()
+        uint64_t value = zero;
+        for (const auto end = position + group; position < end; ++position)
         {
-            break;
+            const auto character = to_unsigned(in[position]);
+            if (character >= base58_value.size() ||
+                base58_value[character] == max_uint8)
+                return false;
+
+            value = value * 58u + base58_value[character];
         }
 
-        ++leading_zeros;
+        multiply_add256(limbs, used, multiplier, value);
     }
 
-    return leading_zeros;
-}
+    // Emit leading zero bytes, then big-endian limb bytes without leading
+    // zero bytes (the most significant limb may have up to three).
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out.assign(leading, 0x00_u8);
+    out.reserve(leading + used * limb_bytes);
+    BC_POP_WARNING()
 
-void unpack_char(data_chunk& data, size_t carry) NOEXCEPT
-{
-    for (auto it = data.rbegin(); it != data.rend(); it++)
+    for (auto limb = used; !is_zero(limb); --limb)
     {
-        carry += 58_size * (*it);
-        *it = carry % 256_size;
-        carry /= 256_size;
+        const auto value = limbs[sub1(limb)];
+        for (auto shift = limb_bytes; !is_zero(shift); --shift)
+        {
+            const auto byte = narrow_cast<uint8_t>(
+                value >> to_bits(sub1(shift)));
+
+            if (out.size() > leading || !is_zero(byte))
+                out.push_back(byte);
+        }
     }
 
-    BC_ASSERT(is_zero(carry));
+    return true;
 }
 
 bool decode_base58(data_chunk& out, const std::string& in) NOEXCEPT
 {
     out.clear();
 
-    // Trim spaces and newlines around the string.
-    const auto leading_zeros = count_leading_zeros(in);
-
-    // log(58) / log(256), rounded up.
-    const size_t data_size = add1(in.size() * 733_size / 1000_size);
-
-    // Allocate enough space in big-endian base256 representation.
-    data_chunk data(data_size);
-
-    // Process the characters.
-    for (auto it = in.begin() + leading_zeros; it != in.end(); ++it)
+    if (in.size() <= stack_limit)
     {
-        const auto carry = base58_chars.find(*it);
-        if (carry == std::string::npos)
+        std_array<uint32_t, decoded_limbs(stack_limit)> limbs;
+        if (!decode(limbs, out, in))
+        {
+            out.clear();
             return false;
+        }
 
-        unpack_char(data, carry);
+        return true;
     }
 
-    // Skip leading zeros in data.
-    const auto first_nonzero = find_first_nonzero(data);
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<uint32_t> limbs(decoded_limbs(in.size()));
+    BC_POP_WARNING()
+
+    if (!decode(limbs, out, in))
+    {
+        out.clear();
+        return false;
+    }
 
-    // Copy result into output vector.
-    const size_t estimated_size = leading_zeros + (data.end() - first_nonzero);
-    out.reserve(estimated_size);
-    out.assign(leading_zeros, 0x00_u8);
-    out.insert(out.end(), first_nonzero, data.cend());
     return true;
 }
 
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 } // namespace system
 } // namespace libbitcoin
@@ -0,0 +1,351 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/serial/props_writer.hpp>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+#include <bitcoin/system/unicode/unicode.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// This mirrors props::write, with depth and separators tracked per open
+// object/array frame instead of by recursion over a props tree.
+
+// Throwing stream aborts.
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr size_t tab = 4;
+
+props_writer::props_writer(std::ostream& stream, format format,
+    bool flat) NOEXCEPT
+  : stream_(stream), format_(format), flat_(flat), name_(), frames_()
+{
+}
+
+props_writer& props_writer::name(const std::string& name) NOEXCEPT
+{
+    name_ = name;
+    return *this;
+}
+
+props_writer& props_writer::null() NOEXCEPT
+{
+    const auto tag = open();
+
+    // XML no-value is distinct from empty text (string).
+    if (format_ != format::xml)
+        stream_ << "null";
+
+    close(tag);
+    return *this;
+}
+
+props_writer& props_writer::boolean(bool value) NOEXCEPT
+{
+    const auto tag = open();
+    stream_ << (value ? "true" : "false");
+    close(tag);
+    return *this;
+}
+
+props_writer& props_writer::text(const std::string& value) NOEXCEPT
+{
+    const auto tag = open();
+    switch (format_)
+    {
+        case format::json:
+        {
+            stream_ << "\"";
+            escape(value);
+            stream_ << "\"";
+            break;
+        }
+        case format::info:
+        {
+            // Unquoted rendering for contiguous text.
+            if (has_whitespace(value))
+                stream_ << "\"" << value << "\"";
+            else
+                stream_ << value;
+
+            break;
+        }
+        case format::xml:
+        {
+            escape(value);
+            break;
+        }
+    }
+
+    close(tag);
+    return *this;
+}
+
+props_writer& props_writer::begin_object() NOEXCEPT
+{
+    begin(true, {});
+    return *this;
+}
+
+props_writer& props_writer::end_object() NOEXCEPT
+{
+    end(true);
+    return *this;
+}
+
+props_writer& props_writer::begin_array(const std::string& element) NOEXCEPT
+{
+    begin(false, element);
+    return *this;
+}
+
+props_writer& props_writer::end_array() NOEXCEPT
+{
+    end(false);
+    return *this;
+}
+
+bool props_writer::is_complete() const NOEXCEPT
+{
+    return frames_.empty() && stream_.good();
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+props_writer& props_writer::number(bool negative, uint64_t value) NOEXCEPT
+{
+    const auto tag = open();
+    stream_ << (negative ? "-" : "") << value;
+    close(tag);
+    return *this;
+}
+
+props_writer& props_writer::invalid() NOEXCEPT
+{
+    stream_result(stream_, false);
+    return *this;
+}
+
+void props_writer::indent(size_t depth) NOEXCEPT
+{
+    if (!flat_)
+        stream_ << "\n" << std::string(depth * tab, ' ');
+}
+
+// Write the separator and name that precede a value, returning the xml tag.
+std::string props_writer::open() NOEXCEPT
+{
+    if (frames_.empty())
+        return {};
+
+    auto& parent = frames_.back();
+    const auto first = is_zero(parent.count++);
+    const auto depth = parent.depth;
+    auto name = parent.object ? std::move(name_) : parent.element;
+    name_.clear();
+
+    switch (format_)
+    {
+        case format::json:
+        {
+            if (!first)
+                stream_ << ",";
+
+            indent(depth);
+            if (parent.object)
+                stream_ << "\"" << name << "\":";
+
+            return {};
+        }
+        case format::info:
+        {
+            // Info uses space (array) or comma (object) separators when flat.
+            if (!first && flat_)
+                stream_ << (parent.object ? "," : " ");
+
+            indent(depth);
+            if (parent.object)
+                stream_ << name << " ";
+
+            return {};
+        }
+        case format::xml:
+        {
+            if (!is_zero(depth))
+                indent(depth);
+
+            stream_ << "<" << name << ">";
+            return name;
+        }
+    }
+
+    return {};
+}
+
+void props_writer::close(const std::string& tag) NOEXCEPT
+{
+    if (!tag.empty())
+        stream_ << "</" << tag << ">";
+}
+
+void props_writer::begin(bool object, const std::string& element) NOEXCEPT
+{
+    const auto named = !frames_.empty() && frames_.back().object;
+    const auto depth = frames_.empty() ?
+        (format_ == format::xml ? zero : one) : add1(frames_.back().depth);
+
+    auto tag = open();
+
+    switch (format_)
+    {
+        case format::json:
+        {
+            // Complex named values start on their own line.
+            if (named)
+                indent(sub1(depth));
+
+            stream_ << (object ? "{" : "[");
+            break;
+        }
+        case format::info:
+        {
+            // Info array uses curved array braces, not square.
+            if (named)
+                indent(sub1(depth));
+
+            stream_ << "{";
+            break;
+        }
+        case format::xml:
+        {
+            break;
+        }
+    }
+
+    frames_.push_back({ object, zero, depth, element, std::move(tag) });
+}
+
+void props_writer::end(bool object) NOEXCEPT
+{
+    if (frames_.empty() || frames_.back().object != object)
+    {
+        invalid();
+        return;
+    }
+
+    const auto frame = std::move(frames_.back());
+    frames_.pop_back();
+
+    switch (format_)
+    {
+        case format::json:
+        {
+            indent(sub1(frame.depth));
+            stream_ << (object ? "}" : "]");
+            break;
+        }
+        case format::info:
+        {
+            indent(sub1(frame.depth));
+            stream_ << "}";
+            break;
+        }
+        case format::xml:
+        {
+            if (!frame.tag.empty())
+            {
+                indent(sub1(frame.depth));
+                close(frame.tag);
+            }
+
+            break;
+        }
+    }
+}
+
+// Escapes as boost::json::serialize (json) and for xml character data.
+void props_writer::escape(const std::string& value) NOEXCEPT
+{
+    constexpr auto hex = "0123456789abcdef";
+    char code[]{ '\\', 'u', '0', '0', '0', '0' };
+    size_t start{};
+
+    for (size_t index = 0; index < value.size(); ++index)
+    {
+        const auto character = value.at(index);
+        std::string_view replacement{};
+
+        if (format_ == format::xml)
+        {
+            switch (character)
+            {
+                case '&': replacement = "&amp;"; break;
+                case '<': replacement = "&lt;"; break;
+                case '>': replacement = "&gt;"; break;
+                default: break;
+            }
+        }
+        else
+        {
+            switch (character)
+            {
+                case '"':  replacement = "\\\""; break;
+                case '\\': replacement = "\\\\"; break;
+                case '\b': replacement = "\\b"; break;
+                case '\f': replacement = "\\f"; break;
+                case '\n': replacement = "\\n"; break;
+                case '\r': replacement = "\\r"; break;
+                case '\t': replacement = "\\t"; break;
+                default:
+                {
+                    const auto byte = static_cast<uint8_t>(character);
+                    if (byte < 0x20u)
+                    {
+                        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+                        code[4] = hex[byte >> 4];
+                        code[5] = hex[byte & 0x0fu];
+                        replacement = { &code[0], sizeof(code) };
+                        BC_POP_WARNING()
+                    }
+                }
+            }
+        }
+
+        // Unescaped runs are written directly from the source.
+        if (!replacement.empty())
+        {
+            stream_.write(std::next(value.data(), start), index - start);
+            stream_ << replacement;
+            start = add1(index);
+        }
+    }
+
+    stream_.write(std::next(value.data(), start), value.size() - start);
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
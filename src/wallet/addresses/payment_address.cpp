@@ -24,6 +24,7 @@
 #include <tuple>
 #include <utility>
 #include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/radix/radix.hpp>
 #include <bitcoin/system/wallet/keys/ec_private.hpp>
@@ -39,6 +40,40 @@ const uint8_t payment_address::mainnet_p2sh = 0x05;
 const uint8_t payment_address::testnet_p2kh = 0x6f;
 const uint8_t payment_address::testnet_p2sh = 0xc4;
 
+// Batch.
+// ----------------------------------------------------------------------------
+
+void payment_address::encode(string_list& out, const short_hashes& hashes,
+    uint8_t prefix) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out.resize(hashes.size());
+    BC_POP_WARNING()
+
+    // The checksum is computed over a stack array, without allocation.
+    std_transform(bc::par_unseq, hashes.begin(), hashes.end(), out.begin(),
+        [=](const short_hash& hash) NOEXCEPT
+        {
+            return encode_base58(payment{ to_array(prefix), hash }.value());
+        });
+}
+
+void payment_address::decode(list& out, const string_list& addresses) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out.resize(addresses.size());
+    BC_POP_WARNING()
+
+    std_transform(bc::par_unseq, addresses.begin(), addresses.end(),
+        out.begin(), [](const std::string& address) NOEXCEPT
+        {
+            return from_string(address);
+        });
+}
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
 payment_address::payment_address() NOEXCEPT
   : payment_()
 {
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/wallet/addresses/stealth_scanner.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/wallet/addresses/payment_address.hpp>
+#include <bitcoin/system/wallet/addresses/stealth_receiver.hpp>
+#include <bitcoin/system/wallet/keys/stealth.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+using namespace system::chain;
+
+// A metadata output that passes a receiver's prefix filter.
+struct candidate
+{
+    size_t receiver;
+    size_t transaction;
+    ec_compressed ephemeral_public;
+};
+
+typedef std::vector<candidate> candidates;
+
+// Pad the leftmost (up to 32) filter bits into a little-endian word.
+static uint32_t to_prefix_word(const data_chunk& bytes) NOEXCEPT
+{
+    data_array<sizeof(uint32_t)> word{};
+    std::copy_n(bytes.begin(), std::min(bytes.size(), word.size()),
+        word.begin());
+    return from_little_endian(word);
+}
+
+// Search the transaction for a pay-key-hash output to the address.
+static std::optional<uint32_t> find_payment(const transaction& tx,
+    const payment_address& address) NOEXCEPT
+{
+    const auto hash = address.hash();
+    const auto& outputs = *tx.outputs_ptr();
+
+    for (uint32_t index = 0; index < outputs.size(); ++index)
+    {
+        const auto& ops = outputs[index]->script().ops();
+        if (script::is_pay_key_hash_pattern(ops) &&
+            std::equal(hash.begin(), hash.end(), ops[2].data().begin()))
+            return index;
+    }
+
+    return {};
+}
+
+// static/private
+stealth_scanner::prefix_filters stealth_scanner::to_filters(
+    const receivers& receivers) NOEXCEPT
+{
+    static const data_chunk ones(sizeof(uint32_t), max_uint8);
+
+    prefix_filters filters{};
+    filters.reserve(receivers.size());
+
+    for (const auto& receiver: receivers)
+    {
+        const auto& filter = receiver.stealth_address().filter();
+        const auto valid = receiver &&
+            filter.bits() <= stealth_address::max_filter_bits;
+
+        // The mask is the filter's bit length applied to a full word, so the
+        // filter compares to a prefix as binary(bits, prefix) == filter.
+        filters.push_back(
+        {
+            valid,
+            to_prefix_word(binary(filter.bits(), ones).data()),
+            to_prefix_word(filter.data())
+        });
+    }
+
+    return filters;
+}
+
+stealth_scanner::stealth_scanner(const receivers& receivers) NOEXCEPT
+  : receivers_(receivers), filters_(to_filters(receivers))
+{
+}
+
+const stealth_scanner::receivers&
+stealth_scanner::stealth_receivers() const NOEXCEPT
+{
+    return receivers_;
+}
+
+stealth_matches stealth_scanner::scan(const block& block) const NOEXCEPT
+{
+    return scan(*block.transactions_ptr());
+}
+
+stealth_matches stealth_scanner::scan(
+    const transaction_cptrs& txs) const NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<size_t> positions(txs.size());
+    std::vector<candidates> filtered(txs.size());
+    BC_POP_WARNING()
+
+    std::iota(positions.begin(), positions.end(), zero);
+
+    // Filter metadata outputs by prefix (one script hash per output).
+    std_transform(bc::par_unseq, positions.begin(), positions.end(),
+        filtered.begin(), [&](size_t position) NOEXCEPT
+        {
+            candidates found{};
+            uint32_t prefix{};
+            ec_compressed ephemeral{};
+
+            for (const auto& output: *txs[position]->outputs_ptr())
+            {
+                const auto& script = output->script();
+                if (!to_stealth_prefix(prefix, script) ||
+                    !extract_ephemeral_key(ephemeral, script))
+                    continue;
+
+                for (size_t index = 0; index < filters_.size(); ++index)
+                {
+                    const auto& filter = filters_[index];
+                    if (filter.valid &&
+                        ((prefix & filter.mask) == filter.value))
+                        found.push_back({ index, position, ephemeral });
+                }
+            }
+
+            return found;
+        });
+
+    candidates all{};
+    for (auto& found: filtered)
+        std::move(found.begin(), found.end(), std::back_inserter(all));
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<std::optional<stealth_match>> derived(all.size());
+    BC_POP_WARNING()
+
+    const auto derive = [&](const candidate& item) NOEXCEPT
+        -> std::optional<stealth_match>
+    {
+        const auto& receiver = receivers_[item.receiver];
+        const auto& tx = *txs[item.transaction];
+
+        payment_address address{};
+        if (!receiver.derive_address(address, item.ephemeral_public))
+            return {};
+
+        const auto output = find_payment(tx, address);
+        if (!output.has_value())
+            return {};
+
+        ec_secret secret{};
+        if (!receiver.derive_private(secret, item.ephemeral_public))
+            return {};
+
+        return stealth_match
+        {
+            item.receiver,
+            item.transaction,
+            output.value(),
+            item.ephemeral_public,
+            std::move(address),
+            secret
+        };
+    };
+
+    // Derive and match addresses for the remaining candidates.
+    std_transform(bc::par_unseq, all.begin(), all.end(), derived.begin(),
+        derive);
+
+    stealth_matches matches{};
+    for (auto& match: derived)
+        if (match.has_value())
+            matches.push_back(std::move(match.value()));
+
+    return matches;
+}
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
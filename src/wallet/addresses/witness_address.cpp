@@ -24,6 +24,8 @@
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/radix/radix.hpp>
 #include <bitcoin/system/unicode/unicode.hpp>
 #include <bitcoin/system/wallet/keys/ec_private.hpp>
@@ -53,6 +55,64 @@ const size_t witness_address::version_0_p2kh_program_size = 20;
 const size_t witness_address::version_0_p2sh_program_size = 32;
 const size_t witness_address::checksum_length = 6;
 
+// Prefix and version are not validated.
+static std::string encode_program(uint8_t version, const data_chunk& program,
+    const std::string& prefix) NOEXCEPT
+{
+    const auto checked = bech32_build_checked(version, program, prefix);
+    return prefix + separator + encode_base32(checked);
+}
+
+template <typename Hashes>
+static void encode_hashes(string_list& out, const Hashes& hashes,
+    const std::string& prefix) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out.clear();
+    out.resize(hashes.size());
+    BC_POP_WARNING()
+
+    // The prefix is validated once for the batch.
+    if (witness_address::parse_prefix(prefix) !=
+        witness_address::parse_result::valid)
+        return;
+
+    std_transform(bc::par_unseq, hashes.begin(), hashes.end(), out.begin(),
+        [&](const typename Hashes::value_type& hash) NOEXCEPT
+        {
+            return encode_program(version_0, to_chunk(hash), prefix);
+        });
+}
+
+// Batch.
+// ----------------------------------------------------------------------------
+
+void witness_address::encode(string_list& out, const short_hashes& hashes,
+    const std::string& prefix) NOEXCEPT
+{
+    encode_hashes(out, hashes, prefix);
+}
+
+void witness_address::encode(string_list& out, const hashes& hashes,
+    const std::string& prefix) NOEXCEPT
+{
+    encode_hashes(out, hashes, prefix);
+}
+
+void witness_address::decode(list& out, const string_list& addresses,
+    bool strict) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out.resize(addresses.size());
+    BC_POP_WARNING()
+
+    std_transform(bc::par_unseq, addresses.begin(), addresses.end(),
+        out.begin(), [=](const std::string& address) NOEXCEPT
+        {
+            return from_address(address, strict);
+        });
+}
+
 // Contructors.
 // ----------------------------------------------------------------------------
 
@@ -378,8 +438,7 @@ std::string witness_address::encoded() const NOEXCEPT
     if (!(*this))
         return {};
 
-    const auto checked = bech32_build_checked(version_, program_, prefix_);
-    return prefix_ + separator + encode_base32(checked);
+    return encode_program(version_, program_, prefix_);
 }
 
 // Properties.
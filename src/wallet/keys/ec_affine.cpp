@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/wallet/keys/ec_affine.hpp>
+
+#include <algorithm>
+#include <vector>
+#include <secp256k1.h>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include "../../crypto/ec_context.hpp"
+
+namespace libbitcoin {
+namespace system {
+
+static_assert(sizeof(secp256k1_pubkey) == 64u);
+
+static constexpr auto ec_success = 1;
+
+// The internal representation is the opaque secp256k1_pubkey.
+BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+
+// static
+const ec_affine& ec_affine::generator() NOEXCEPT
+{
+    static const ec_affine point{ ec_compressed_generator };
+    return point;
+}
+
+// static
+ec_affine ec_affine::from_scalar(const ec_scalar& scalar) NOEXCEPT
+{
+    if (!scalar)
+        return {};
+
+    ec_affine out{};
+    const auto context = ec_context_sign::context();
+    const auto key = pointer_cast<secp256k1_pubkey>(out.point_.data());
+    out.valid_ = secp256k1_ec_pubkey_create(context, key,
+        scalar.secret().data()) == ec_success;
+
+    return out;
+}
+
+// static
+ec_affine ec_affine::sum(const affine_list& points) NOEXCEPT
+{
+    const auto invalid = [](const ec_affine& point) NOEXCEPT
+    {
+        return !point;
+    };
+
+    if (points.empty() || std::any_of(points.begin(), points.end(), invalid))
+        return {};
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<const secp256k1_pubkey*> keys(points.size());
+    BC_POP_WARNING()
+
+    std::transform(points.begin(), points.end(), keys.begin(),
+        [](const ec_affine& point) NOEXCEPT
+        {
+            return pointer_cast<const secp256k1_pubkey>(point.point_.data());
+        });
+
+    // Points are accumulated in Jacobian form and normalized once.
+    ec_affine out{};
+    const auto context = ec_context_verify::context();
+    const auto key = pointer_cast<secp256k1_pubkey>(out.point_.data());
+    out.valid_ = secp256k1_ec_pubkey_combine(context, key, keys.data(),
+        keys.size()) == ec_success;
+
+    return out;
+}
+
+// static
+compressed_list ec_affine::compress(const affine_list& points) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    compressed_list out(points.size());
+    BC_POP_WARNING()
+
+    std::transform(points.begin(), points.end(), out.begin(),
+        [](const ec_affine& point) NOEXCEPT
+        {
+            return point.point();
+        });
+
+    return out;
+}
+
+// construction
+// ----------------------------------------------------------------------------
+
+ec_affine::ec_affine() NOEXCEPT
+  : point_{}, valid_(false)
+{
+}
+
+ec_affine::ec_affine(const ec_compressed& compressed) NOEXCEPT
+  : point_{}, valid_(false)
+{
+    const auto context = ec_context_verify::context();
+    const auto key = pointer_cast<secp256k1_pubkey>(point_.data());
+    valid_ = secp256k1_ec_pubkey_parse(context, key, compressed.data(),
+        compressed.size()) == ec_success;
+}
+
+ec_affine::ec_affine(const ec_point& point) NOEXCEPT
+  : ec_affine(point ? ec_affine{ point.point() } : ec_affine{})
+{
+}
+
+// arithmetic assignment operators
+// ----------------------------------------------------------------------------
+
+ec_affine& ec_affine::operator+=(const ec_affine& point) NOEXCEPT
+{
+    if (!valid_)
+        return *this;
+
+    *this = sum({ *this, point });
+    return *this;
+}
+
+ec_affine& ec_affine::operator-=(const ec_affine& point) NOEXCEPT
+{
+    if (!valid_)
+        return *this;
+
+    *this = sum({ *this, -point });
+    return *this;
+}
+
+ec_affine& ec_affine::operator*=(const ec_scalar& scalar) NOEXCEPT
+{
+    if (!valid_)
+        return *this;
+
+    if (!scalar)
+    {
+        *this = {};
+        return *this;
+    }
+
+    const auto context = ec_context_verify::context();
+    const auto key = pointer_cast<secp256k1_pubkey>(point_.data());
+    valid_ = secp256k1_ec_pubkey_tweak_mul(context, key,
+        scalar.secret().data()) == ec_success;
+
+    return *this;
+}
+
+// unary operators (const)
+// ----------------------------------------------------------------------------
+
+ec_affine ec_affine::operator-() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    auto out = *this;
+    const auto context = ec_context_verify::context();
+    const auto key = pointer_cast<secp256k1_pubkey>(out.point_.data());
+    out.valid_ = secp256k1_ec_pubkey_negate(context, key) == ec_success;
+    return out;
+}
+
+// binary math operators (const)
+// ----------------------------------------------------------------------------
+
+ec_affine operator+(const ec_affine& left, const ec_affine& right) NOEXCEPT
+{
+    if (!left || !right)
+        return {};
+
+    auto out = left;
+    return out += right;
+}
+
+ec_affine operator-(const ec_affine& left, const ec_affine& right) NOEXCEPT
+{
+    if (!left || !right)
+        return {};
+
+    auto out = left;
+    return out -= right;
+}
+
+ec_affine operator*(const ec_affine& left, const ec_scalar& right) NOEXCEPT
+{
+    if (!left || !right)
+        return {};
+
+    auto out = left;
+    return out *= right;
+}
+
+ec_affine operator*(const ec_scalar& left, const ec_affine& right) NOEXCEPT
+{
+    return right * left;
+}
+
+// comparison operators (const)
+// ----------------------------------------------------------------------------
+
+// The internal representation is not guaranteed to be canonical.
+bool operator==(const ec_affine& left, const ec_affine& right) NOEXCEPT
+{
+    return left.point() == right.point();
+}
+
+bool operator!=(const ec_affine& left, const ec_affine& right) NOEXCEPT
+{
+    return !(left == right);
+}
+
+// cast operators
+// ----------------------------------------------------------------------------
+
+ec_affine::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+ec_affine::operator ec_point() const NOEXCEPT
+{
+    return valid_ ? ec_point{ point() } : ec_point{};
+}
+
+// properties
+// ----------------------------------------------------------------------------
+
+ec_compressed ec_affine::point() const NOEXCEPT
+{
+    if (!valid_)
+        return null_ec_compressed;
+
+    auto size = ec_compressed_size;
+    ec_compressed out{};
+    const auto context = ec_context_verify::context();
+    const auto key = pointer_cast<const secp256k1_pubkey>(point_.data());
+    secp256k1_ec_pubkey_serialize(context, out.data(), &size, key,
+        SECP256K1_EC_COMPRESSED);
+
+    return size == ec_compressed_size ? out : null_ec_compressed;
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
@@ -18,6 +18,8 @@
  */
 #include <bitcoin/system/wallet/message.hpp>
 
+#include <algorithm>
+#include <vector>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 #include <bitcoin/system/wallet/keys/ec_private.hpp>
@@ -137,7 +139,8 @@ bool sign_message(message_signature& out_signature, const data_slice& message,
     return true;
 }
 
-bool verify_message(const data_slice& message, const payment_address& address,
+static bool verify_digest(const hash_digest& message_digest,
+    const payment_address& address,
     const message_signature& signature) NOEXCEPT
 {
     const auto magic = signature.front();
@@ -149,11 +152,38 @@ bool verify_message(const data_slice& message, const payment_address& address,
         return false;
 
     short_hash hash;
-    const auto message_digest = hash_message(message);
     return recover(hash, compressed, compact, recovery_id, message_digest) &&
         (hash == address.hash());
 }
 
+bool verify_message(const data_slice& message, const payment_address& address,
+    const message_signature& signature) NOEXCEPT
+{
+    return verify_digest(hash_message(message), address, signature);
+}
+
+message_bitmap verify_messages(const signed_messages& items) NOEXCEPT
+{
+    // Bytes are written concurrently, vector<bool> bits cannot be.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<uint8_t> verified(items.size());
+    BC_POP_WARNING()
+
+    // Items are independent (hashing and recovery), so each is a task.
+    std_transform(bc::par_unseq, items.begin(), items.end(), verified.begin(),
+        [](const signed_message& item) NOEXCEPT -> uint8_t
+        {
+            return verify_digest(hash_message(item.message), item.address,
+                item.signature) ? 1 : 0;
+        });
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const message_bitmap bitmap(verified.begin(), verified.end());
+    BC_POP_WARNING()
+
+    return bitmap;
+}
+
 } // namespace wallet
 } // namespace system
 } // namespace libbitcoin
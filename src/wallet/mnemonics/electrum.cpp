@@ -18,7 +18,11 @@
  */
 #include <bitcoin/system/wallet/mnemonics/electrum.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <string>
+#include <vector>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -55,6 +59,9 @@ static const auto version_none = "none";
 static const auto index_bits = narrow_cast<uint8_t>(floored_log2(
     electrum::dictionary::size()));
 
+// Number of grinding iterations evaluated concurrently.
+static constexpr size_t grind_batch = 128;
+
 // private static
 // ----------------------------------------------------------------------------
 
@@ -104,12 +111,14 @@ data_chunk electrum::decoder(const string_list& words,
 // The Electrum prng minimum value technique sacrifices 11 bits of entropy by
 // discarding any prng value that is below 2^(strength-11).
 // github.com/spesmilo/electrum/blob/master/electrum/mnemonic.py#L190-L205
+// The hash chain is sequential but cheap relative to encoding and validation,
+// so it is precomputed for a batch of iterations that are then evaluated
+// concurrently. Iterations after a known match are skipped, and the first
+// match in the batch is selected, so the result is the same as sequential.
 electrum::grinding electrum::grinder(const data_chunk& entropy,
     seed_prefix prefix, language identifier, size_t limit) NOEXCEPT
 {
-    string_list words;
     data_chunk hash(entropy);
-    const auto start = limit;
 
     // Remove unusable entropy bytes.
     const auto entropy_size = usable_size(hash);
@@ -118,30 +127,66 @@ electrum::grinding electrum::grinder(const data_chunk& entropy,
     // Create a byte mask for zeroizing entropy pad bits.
     const auto padding_mask = 0xff << unused_bits(hash);
 
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<data_chunk> hashes(grind_batch);
+    std::vector<string_list> words(grind_batch);
+    std::vector<size_t> positions(grind_batch);
+    BC_POP_WARNING()
+
+    std::iota(positions.begin(), positions.end(), zero);
+
     // This just grinds away until exhausted or prefix found.
     // Previously-discovered entropy round-trips, matching on the first pass.
-    do
+    const auto count = ceilinged_add(limit, one);
+    for (size_t start = 0; start < count;
+        start = ceilinged_add(start, grind_batch))
     {
-        // Normalize entropy to the wordlist by managing its pad bits.
-        // Electrum pads to the left, but entropy is a private format for
-        // electrum and public for bip39, so we use the bip39/mnemonic format.
-        // This results in any electrum entropy/prefix value producing the same
-        // words as that same entropy/checksum value in bip39/mnemonic.
-        hash[sub1(entropy_size)] &= padding_mask;
-        words = encoder(hash, identifier);
-
-        // Avoid collisions with Electrum v1 (en) and BIP39 mnemonics.
-        // Run validator first because conflict checks can be costly.
-        if (validator(words, prefix) && !is_conflict(words))
-            return { hash, words, start - limit };
-
-        // This replaces Electrum's prng with determinism.
-        hash = to_chunk(sha512_hash(hash));
-        hash.resize(entropy_size);
+        const auto size = std::min(grind_batch, count - start);
+
+        for (size_t index = 0; index < size; ++index)
+        {
+            // Normalize entropy to the wordlist by managing its pad bits.
+            // Electrum pads to the left, but entropy is a private format for
+            // electrum and public for bip39, so we use the bip39/mnemonic
+            // format. This results in any electrum entropy/prefix value
+            // producing the same words as that same entropy/checksum value in
+            // bip39/mnemonic.
+            hash[sub1(entropy_size)] &= padding_mask;
+            hashes[index] = hash;
+
+            // This replaces Electrum's prng with determinism.
+            hash = to_chunk(sha512_hash(hash));
+            hash.resize(entropy_size);
+        }
+
+        std::atomic<size_t> first{ size };
+        const auto evaluate = [&](size_t index) NOEXCEPT
+        {
+            // A preceding iteration has already matched.
+            if (index > first.load(std::memory_order_relaxed))
+                return;
+
+            words[index] = encoder(hashes[index], identifier);
+
+            // Avoid collisions with Electrum v1 (en) and BIP39 mnemonics.
+            // Run validator first because conflict checks can be costly.
+            if (!validator(words[index], prefix) || is_conflict(words[index]))
+                return;
+
+            auto current = first.load(std::memory_order_relaxed);
+            while (index < current && !first.compare_exchange_weak(current,
+                index, std::memory_order_relaxed));
+        };
+
+        std_for_each(bc::par_unseq, positions.begin(),
+            std::next(positions.begin(), size), evaluate);
+
+        const auto match = first.load();
+        if (match < size)
+            return { hashes[match], words[match], start + match };
     }
-    while (!is_zero(limit--));
 
-    return { {}, {}, start };
+    return { {}, {}, limit };
 }
 
 // This cannot match electrum_v1 or mnemonic.
@@ -152,8 +197,18 @@ bool electrum::validator(const string_list& words, seed_prefix prefix) NOEXCEPT
     sentence = to_non_combining_form(sentence);
     sentence = to_compressed_form(sentence);
 
-    const auto seed = hmac<sha512>::code(sentence, "Seed version");
-    return starts_with(encode_base16(seed), to_version(prefix));
+    // The keyed hmac state is computed once and copied for each sentence.
+    static const hmac<sha512> seed_version{ "Seed version" };
+    auto mac = seed_version;
+    mac.write(sentence);
+    const auto seed = mac.flush();
+
+    // Only the leading bytes required to cover the version are encoded.
+    const auto version = to_version(prefix);
+    const auto bytes = std::min(ceilinged_divide(version.size(), two),
+        seed.size());
+    return starts_with(encode_base16(data_slice{ seed.begin(),
+        std::next(seed.begin(), bytes) }), version);
 }
 
 // Electrum uses the same normalization function for words and passphrases.
@@ -19,7 +19,9 @@
 #include <bitcoin/system/wallet/mnemonics/mnemonic.hpp>
 
 #include <string>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/radix/radix.hpp>
@@ -74,11 +76,35 @@ string_list mnemonic::encoder(const data_chunk& entropy,
 data_chunk mnemonic::decoder(const string_list& words,
     language identifier) NOEXCEPT
 {
-    // Words are the base2048 decoding, so this is word encoding.
-    data_chunk buffer;
-    if (!encode_base2048_list(buffer, words, identifier))
+    // Words are the base2048 decoding, so this is word encoding. Indexes are
+    // packed directly (big-endian), avoiding the intermediate bit stream.
+    const auto indexes = dictionaries_.index(words, identifier);
+    if (indexes.empty())
         return {};
 
+    data_chunk buffer{};
+    buffer.reserve(to_ceilinged_bytes(indexes.size() * index_bits));
+
+    uint32_t accumulator{};
+    size_t pending{};
+    for (const auto index: indexes)
+    {
+        if (is_negative(index))
+            return {};
+
+        accumulator = (accumulator << index_bits) |
+            possible_sign_cast<uint32_t>(index);
+
+        for (pending += index_bits; pending >= byte_bits; pending -= byte_bits)
+            buffer.push_back(narrow_cast<uint8_t>(
+                accumulator >> (pending - byte_bits)));
+    }
+
+    // Remaining bits are zero-padded into the last byte.
+    if (!is_zero(pending))
+        buffer.push_back(narrow_cast<uint8_t>(
+            accumulator << (byte_bits - pending)));
+
     // Entropy is always byte aligned.
     // Checksum is in high order bits of last buffer byte, zero-padded.
     const data_chunk entropy{ buffer.begin(), std::prev(buffer.end()) };
@@ -189,6 +215,41 @@ bool mnemonic::is_valid_word_count(size_t count) NOEXCEPT
         count >= word_minimum && count <= word_maximum);
 }
 
+data_stack mnemonic::decode(const word_lists& lists,
+    language identifier) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    data_stack entropies(lists.size());
+    BC_POP_WARNING()
+
+    // Lists are independent (normalization, lookup and hashing).
+    std_transform(bc::par_unseq, lists.begin(), lists.end(), entropies.begin(),
+        [=](const string_list& words) NOEXCEPT
+        {
+            return from_words(words, identifier).entropy();
+        });
+
+    return entropies;
+}
+
+std::vector<bool> mnemonic::validate(const word_lists& lists,
+    language identifier) NOEXCEPT
+{
+    const auto entropies = decode(lists, identifier);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<bool> valid(entropies.size());
+    BC_POP_WARNING()
+
+    std::transform(entropies.begin(), entropies.end(), valid.begin(),
+        [](const data_chunk& entropy) NOEXCEPT
+        {
+            return !entropy.empty();
+        });
+
+    return valid;
+}
+
 // construction
 // ----------------------------------------------------------------------------
 
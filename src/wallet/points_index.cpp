@@ -0,0 +1,356 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/wallet/points_index.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/wallet/point_value.hpp>
+#include <bitcoin/system/wallet/points_value.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// static/private
+// ----------------------------------------------------------------------------
+
+point_value::list& points_index::sort(point_value::list& points) NOEXCEPT
+{
+    const auto greater = [](const point_value& left,
+        const point_value& right) NOEXCEPT
+        {
+            return left.value() > right.value();
+        };
+
+    // C++17: Parallel policy for std::sort.
+    std::sort(points.begin(), points.end(), greater);
+    return points;
+}
+
+// remaining[i] is the value of points [i, size), with remaining[size] zero.
+points_index::totals points_index::remaining(
+    const point_value::list& points) NOEXCEPT
+{
+    totals out(add1(points.size()), zero);
+    for (auto position = points.size(); !is_zero(position); --position)
+        out[sub1(position)] = ceilinged_add(out[position],
+            points[sub1(position)].value());
+
+    return out;
+}
+
+// constructors
+// ----------------------------------------------------------------------------
+
+points_index::points_index(const points_value& unspent) NOEXCEPT
+  : points_index(point_value::list{ unspent.points })
+{
+}
+
+points_index::points_index(point_value::list&& unspent) NOEXCEPT
+  : points_(std::move(sort(unspent))), remaining_(remaining(points_))
+{
+}
+
+// properties
+// ----------------------------------------------------------------------------
+
+const point_value::list& points_index::points() const NOEXCEPT
+{
+    return points_;
+}
+
+uint64_t points_index::value() const NOEXCEPT
+{
+    return remaining_.front();
+}
+
+// selection
+// ----------------------------------------------------------------------------
+
+void points_index::select(points_value& out, uint64_t minimum_value,
+    selection option) const NOEXCEPT
+{
+    switch (option)
+    {
+        case selection::individual:
+            individual(out, minimum_value);
+            break;
+        case selection::branch_and_bound:
+            branch_and_bound(out, minimum_value);
+            break;
+        case selection::knapsack:
+            knapsack(out, minimum_value);
+            break;
+        case selection::greedy:
+        default:
+            greedy(out, minimum_value);
+            break;
+    }
+}
+
+// Depth-first search of include/exclude decisions over descending values.
+// A branch is abandoned when it cannot reach the minimum with all remaining
+// points, or when it cannot improve on the best set found. Including a point
+// equal in value to the preceding excluded point repeats a searched branch.
+void points_index::branch_and_bound(points_value& out, uint64_t minimum_value,
+    size_t tries) const NOEXCEPT
+{
+    out.points.clear();
+
+    // The minimum required value does not exist.
+    if (value() < minimum_value)
+        return;
+
+    positions selected{};
+    positions best{};
+    uint64_t total{};
+    auto best_total = max_uint64;
+
+    for (size_t position = 0; !is_zero(tries); --tries, ++position)
+    {
+        auto backtrack = true;
+
+        if (total >= minimum_value)
+        {
+            if (total < best_total)
+            {
+                best = selected;
+                best_total = total;
+            }
+
+            // Exact value cannot be improved upon.
+            if (total == minimum_value)
+                break;
+        }
+        else if (ceilinged_add(total, remaining(position)) >= minimum_value)
+        {
+            const auto value = points_[position].value();
+            const auto skip = !is_zero(position) &&
+                (selected.empty() || selected.back() != sub1(position)) &&
+                (points_[sub1(position)].value() == value);
+
+            // Include the point (or skip its redundant inclusion).
+            if (!skip)
+            {
+                selected.push_back(position);
+                total = ceilinged_add(total, value);
+            }
+
+            backtrack = false;
+        }
+
+        if (backtrack)
+        {
+            if (selected.empty())
+                break;
+
+            // Exclude the most recently included point and continue after it.
+            position = selected.back();
+            total -= points_[position].value();
+            selected.pop_back();
+        }
+    }
+
+    if (best.empty())
+    {
+        greedy(out, minimum_value);
+        return;
+    }
+
+    assign(out, best);
+}
+
+// Randomized approximation of the least sufficient subset of the points
+// individually below the minimum, compared to the smallest sufficient point.
+void points_index::knapsack(points_value& out, uint64_t minimum_value,
+    size_t iterations) const NOEXCEPT
+{
+    out.points.clear();
+
+    // The minimum required value does not exist.
+    if (value() < minimum_value)
+        return;
+
+    const auto lowest = sufficient(minimum_value);
+    const auto lower_total = remaining(lowest);
+    const auto has_larger = !is_zero(lowest);
+    const auto larger = has_larger ? sub1(lowest) : zero;
+
+    // An exactly sufficient point, or insufficient smaller points.
+    if ((has_larger && points_[larger].value() == minimum_value) ||
+        lower_total < minimum_value)
+    {
+        out.points.push_back(points_[larger]);
+        return;
+    }
+
+    positions best{};
+    for (auto position = lowest; position < points_.size(); ++position)
+        best.push_back(position);
+
+    auto best_total = lower_total;
+    std::vector<bool> included(points_.size());
+    uint64_t random{};
+    size_t available{};
+
+    const auto coin = [&]() NOEXCEPT
+    {
+        if (is_zero(available))
+        {
+            random = pseudo_random::next<uint64_t>();
+            available = bits<uint64_t>;
+        }
+
+        --available;
+        const auto bit = to_bool(random & 1u);
+        random >>= 1;
+        return bit;
+    };
+
+    for (; !is_zero(iterations) && best_total != minimum_value; --iterations)
+    {
+        uint64_t total{};
+        auto reached = false;
+        std::fill(included.begin(), included.end(), false);
+
+        // First pass includes at random, second includes all others.
+        for (auto pass = 0; pass < 2 && !reached; ++pass)
+        {
+            for (auto position = lowest; position < points_.size();
+                ++position)
+            {
+                if (included[position] || (is_zero(pass) && !coin()))
+                    continue;
+
+                const auto value = points_[position].value();
+                total = ceilinged_add(total, value);
+                included[position] = true;
+
+                if (total >= minimum_value)
+                {
+                    reached = true;
+                    if (total < best_total)
+                    {
+                        best_total = total;
+                        best.clear();
+                        for (auto index = lowest; index < points_.size();
+                            ++index)
+                            if (included[index])
+                                best.push_back(index);
+                    }
+
+                    // Continue to search for a lesser total.
+                    total -= value;
+                    included[position] = false;
+                }
+            }
+        }
+    }
+
+    // The smallest sufficient point is preferred unless the set is lesser.
+    if (has_larger && best_total != minimum_value &&
+        points_[larger].value() <= best_total)
+    {
+        out.points.push_back(points_[larger]);
+        return;
+    }
+
+    assign(out, best);
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+size_t points_index::sufficient(uint64_t minimum_value) const NOEXCEPT
+{
+    const auto end = std::partition_point(points_.begin(), points_.end(),
+        [minimum_value](const point_value& point) NOEXCEPT
+        {
+            return point.value() >= minimum_value;
+        });
+
+    return possible_narrow_and_sign_cast<size_t>(
+        std::distance(points_.begin(), end));
+}
+
+uint64_t points_index::remaining(size_t position) const NOEXCEPT
+{
+    return remaining_[position];
+}
+
+// Same results as points_value::greedy, without search.
+void points_index::greedy(points_value& out,
+    uint64_t minimum_value) const NOEXCEPT
+{
+    out.points.clear();
+
+    // The minimum required value does not exist.
+    if (value() < minimum_value)
+        return;
+
+    // If there are values large enough, return the smallest (of the largest).
+    const auto lowest = sufficient(minimum_value);
+    if (!is_zero(lowest))
+    {
+        out.points.push_back(points_[sub1(lowest)]);
+        return;
+    }
+
+    // Take the largest values first in order to use the fewest inputs.
+    uint64_t total{};
+    for (auto point = points_.begin(); total < minimum_value; ++point)
+    {
+        total = ceilinged_add(total, point->value());
+        out.points.push_back(*point);
+    }
+}
+
+// Same results as points_value::individual, without search.
+void points_index::individual(points_value& out,
+    uint64_t minimum_value) const NOEXCEPT
+{
+    // Sufficient points are leading, return in ascending order by value.
+    const auto end = std::next(points_.begin(), sufficient(minimum_value));
+    out.points.assign(std::make_reverse_iterator(end), points_.rend());
+}
+
+void points_index::assign(points_value& out,
+    const positions& selected) const NOEXCEPT
+{
+    out.points.clear();
+    out.points.reserve(selected.size());
+
+    for (const auto position: selected)
+        out.points.push_back(points_[position]);
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
@@ -18,9 +18,11 @@
  */
 #include <bitcoin/system/wallet/points_value.hpp>
 
+#include <algorithm>
 #include <numeric>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/wallet/point_value.hpp>
+#include <bitcoin/system/wallet/points_index.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -60,12 +62,6 @@ void points_value::greedy(points_value& out, const points_value& unspent,
             return left.value() < right.value();
         };
 
-    const auto greater = [](const point_value& left,
-        const point_value& right) NOEXCEPT
-        {
-            return left.value() > right.value();
-        };
-
     // C++17: Parallel policy for std::partition.
     // Reorder list between values that exceed minimum and those that do not.
     const auto sufficient = std::partition(points.begin(), points.end(), below);
@@ -80,17 +76,19 @@ void points_value::greedy(points_value& out, const points_value& unspent,
         return;
     }
 
-    // C++17: Parallel policy for std::sort.
-    // Sort all by descending value in order to use the fewest inputs possible.
-    std::sort(points.begin(), points.end(), greater);
+    // Take the largest values first in order to use the fewest inputs
+    // possible. A heap orders only as many values as are taken.
+    std::make_heap(points.begin(), points.end(), lesser);
 
     // This is naive, will not necessarily find the smallest combination.
-    for (const auto& point: points)
+    uint64_t total{};
+    auto end = points.end();
+    while (total < minimum_value && end != points.begin())
     {
-        out.points.push_back(point);
-
-        if (out.value() >= minimum_value)
-            return;
+        std::pop_heap(points.begin(), end, lesser);
+        const auto& largest = *(--end);
+        total = ceilinged_add(total, largest.value());
+        out.points.push_back(largest);
     }
 }
 
@@ -126,6 +124,10 @@ void points_value::select(points_value& out, const points_value& unspent,
         case selection::individual:
             individual(out, unspent, minimum_value);
             break;
+        case selection::branch_and_bound:
+        case selection::knapsack:
+            points_index{ unspent }.select(out, minimum_value, option);
+            break;
         case selection::greedy:
         default:
             greedy(out, unspent, minimum_value);
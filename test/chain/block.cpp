@@ -555,6 +555,104 @@ BOOST_AUTO_TEST_CASE(block__is_invalid_merkle_root__block100k__false)
 // is_signature_operations_limited
 // is_unspent_coinbase_collision
 
+// populate_hashes
+
+static const chain::block hashes_block
+{
+    header{},
+    transactions
+    {
+        {
+            1,
+            inputs
+            {
+                { point{}, script{}, witness{ data_stack{ { 0x42 } } }, 0 }
+            },
+            outputs{ { 42, script{} } },
+            0
+        },
+        {
+            1,
+            inputs{ { point{ one_hash, 0 }, script{}, 0 } },
+            outputs{ { 24, script{} } },
+            0
+        },
+        {
+            2,
+            inputs
+            {
+                { point{ one_hash, 1 }, script{}, witness{ data_stack{ { 0x24 } } }, 0 }
+            },
+            outputs{ { 42, script{} } },
+            0
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(block__populate_hashes__witness__unchanged_hashes)
+{
+    const auto expected = hashes_block.transaction_hashes(false);
+    const auto expected_witness = hashes_block.transaction_hashes(true);
+    BOOST_REQUIRE_EQUAL(expected_witness.front(), null_hash);
+    BOOST_REQUIRE_EQUAL(expected_witness[1], expected[1]);
+    BOOST_REQUIRE_NE(expected_witness[2], expected[2]);
+
+    hashes_block.populate_hashes(true);
+    BOOST_REQUIRE_EQUAL(hashes_block.transaction_hashes(false), expected);
+    BOOST_REQUIRE_EQUAL(hashes_block.transaction_hashes(true), expected_witness);
+}
+
+BOOST_AUTO_TEST_CASE(block__populate_hashes__empty__does_not_throw)
+{
+    BOOST_REQUIRE_NO_THROW(chain::block{}.populate_hashes(true));
+}
+
+BOOST_AUTO_TEST_CASE(block__populate_hashes__repeated__retains_existing_caches)
+{
+    const chain::block instance{ hashes_block.to_data(true), true };
+    const auto& txs = *instance.transactions_ptr();
+    BOOST_REQUIRE(!txs[1]->is_hashed(false));
+    BOOST_REQUIRE(!txs[2]->is_hashed(true));
+
+    // Sentinel caches would be replaced by computed hashes if overwritten.
+    txs[1]->set_hash(hash_digest{ one_hash });
+    txs[2]->set_witness_hash(hash_digest{ one_hash });
+
+    instance.populate_hashes(true);
+    instance.populate_hashes(true);
+    BOOST_REQUIRE(txs[0]->is_hashed(false));
+    BOOST_REQUIRE(!txs[0]->is_hashed(true));
+    BOOST_REQUIRE(!txs[1]->is_hashed(true));
+    BOOST_REQUIRE(txs[2]->is_hashed(false));
+    BOOST_REQUIRE_EQUAL(txs[1]->hash(false), one_hash);
+    BOOST_REQUIRE_EQUAL(txs[2]->hash(true), one_hash);
+}
+
+BOOST_AUTO_TEST_CASE(block__populate_hashes__not_witness__witness_hashes_not_cached)
+{
+    const chain::block instance{ hashes_block.to_data(true), true };
+    instance.populate_hashes(false);
+
+    for (const auto& tx: *instance.transactions_ptr())
+    {
+        BOOST_REQUIRE(tx->is_hashed(false));
+        BOOST_REQUIRE(!tx->is_hashed(true));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block__check__any__does_not_cache_hashes)
+{
+    const chain::block instance{ hashes_block.to_data(true), true };
+    instance.check();
+    instance.check();
+
+    for (const auto& tx: *instance.transactions_ptr())
+    {
+        BOOST_REQUIRE(!tx->is_hashed(false));
+        BOOST_REQUIRE(!tx->is_hashed(true));
+    }
+}
+
 // json
 // ----------------------------------------------------------------------------
 
@@ -669,6 +767,12 @@ BOOST_AUTO_TEST_CASE(block__json__conversions__expected)
 
     BOOST_REQUIRE(json::value_from(instance) == value);
     BOOST_REQUIRE(json::value_to<chain::block>(value) == instance);
+
+    std::ostringstream stream;
+    props_writer writer(stream, props::format::json);
+    chain::to_props(writer, instance);
+    BOOST_REQUIRE(writer.is_complete());
+    BOOST_REQUIRE_EQUAL(stream.str(), text);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
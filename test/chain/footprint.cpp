@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(footprint_tests)
+
+using namespace system::chain;
+
+static const transaction tx
+{
+    42,
+    inputs
+    {
+        {
+            point{ one_hash, 24 },
+            script{ { { opcode::op_return }, { data_chunk(20, 0x42), true } } },
+            witness{ data_stack{ { 0x24, 0x24, 0x24 }, { 0x42, 0x42, 0x42 } } },
+            42
+        }
+    },
+    outputs
+    {
+        { 24, script{ { { opcode::pick } } } }
+    },
+    24
+};
+
+BOOST_AUTO_TEST_CASE(footprint__point__sizeof)
+{
+    BOOST_REQUIRE_EQUAL(footprint(point{}), sizeof(point));
+}
+
+BOOST_AUTO_TEST_CASE(footprint__operation__no_data__sizeof)
+{
+    BOOST_REQUIRE_EQUAL(footprint(operation{ opcode::pick }), sizeof(operation));
+}
+
+BOOST_AUTO_TEST_CASE(footprint__operation__data__exceeds_data_size)
+{
+    const operation push{ data_chunk(20, 0x42), true };
+    BOOST_REQUIRE_GE(footprint(push), sizeof(operation) + sizeof(data_chunk) + 20u);
+}
+
+BOOST_AUTO_TEST_CASE(footprint__script__empty__sizeof)
+{
+    BOOST_REQUIRE_EQUAL(footprint(script{}), sizeof(script));
+}
+
+BOOST_AUTO_TEST_CASE(footprint__witness__elements__exceeds_element_sizes)
+{
+    const witness instance{ data_stack{ { 0x24, 0x24, 0x24 }, { 0x42 } } };
+    BOOST_REQUIRE_GE(footprint(instance), sizeof(witness) + 2u * sizeof(data_chunk) + 4u);
+}
+
+BOOST_AUTO_TEST_CASE(footprint__transaction__exceeds_element_footprints)
+{
+    const auto& input = *tx.inputs_ptr()->front();
+    const auto& output = *tx.outputs_ptr()->front();
+    BOOST_REQUIRE_GT(footprint(tx), footprint(input) + footprint(output));
+    BOOST_REQUIRE_GT(footprint(input), footprint(input.script()) + footprint(input.witness()));
+}
+
+BOOST_AUTO_TEST_CASE(footprint__packed_transaction__less_than_transaction)
+{
+    const packed_transaction packed{ tx };
+    BOOST_REQUIRE_EQUAL(footprint(packed), sizeof(packed_transaction) + packed.buffer_size());
+    BOOST_REQUIRE_GT(packed.buffer_size(), tx.serialized_size(true));
+    BOOST_REQUIRE_LT(footprint(packed), footprint(tx));
+}
+
+BOOST_AUTO_TEST_CASE(footprint__block__exceeds_transactions)
+{
+    const block instance{ header{}, transactions{ tx, tx } };
+    BOOST_REQUIRE_GT(footprint(instance), two * footprint(tx) + sizeof(header));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
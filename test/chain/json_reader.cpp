@@ -0,0 +1,324 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(json_reader_tests)
+
+using namespace system::chain;
+
+static const std::string tx_text
+{
+    "{"
+        "\"version\":42,"
+        "\"inputs\":"
+        "["
+            "{"
+                "\"point\":"
+                "{"
+                    "\"hash\":\"0000000000000000000000000000000000000000000000000000000000000000\","
+                    "\"index\":24"
+                "},"
+                "\"script\":\"return pick\","
+                "\"witness\":\"[242424]\","
+                "\"sequence\":42"
+            "},"
+            "{"
+                "\"point\":"
+                "{"
+                    "\"hash\":\"0000000000000000000000000000000000000000000000000000000000000001\","
+                    "\"index\":42"
+                "},"
+                "\"script\":\"return roll\","
+                "\"witness\":\"[424242]\","
+                "\"sequence\":24"
+            "}"
+        "],"
+        "\"outputs\":"
+        "["
+            "{"
+                "\"value\":24,"
+                "\"script\":\"pick\""
+            "},"
+            "{"
+                "\"value\":42,"
+                "\"script\":\"roll\""
+            "}"
+        "],"
+        "\"locktime\":24"
+    "}"
+};
+
+static const transaction expected_tx
+{
+    42,
+    inputs
+    {
+        input
+        {
+            point{ null_hash, 24 },
+            script{ { { opcode::op_return }, { opcode::pick } } },
+            witness{ "[242424]" },
+            42
+        },
+        input
+        {
+            point{ one_hash, 42 },
+            script{ { { opcode::op_return }, { opcode::roll } } },
+            witness{ "[424242]" },
+            24
+        }
+    },
+    outputs
+    {
+        output{ 24, script{ { { opcode::pick } } } },
+        output{ 42, script{ { { opcode::roll } } } }
+    },
+    24
+};
+
+static const std::string header_text
+{
+    "{"
+        "\"version\":42,"
+        "\"previous\":\"0000000000000000000000000000000000000000000000000000000000000000\","
+        "\"merkle_root\":\"0000000000000000000000000000000000000000000000000000000000000001\","
+        "\"timestamp\":43,"
+        "\"bits\":44,"
+        "\"nonce\":45"
+    "}"
+};
+
+static const header expected_header{ 42, null_hash, one_hash, 43, 44, 45 };
+
+// Replace the first occurrence of from with to in text.
+static std::string replace(std::string text, const std::string& from,
+    const std::string& to)
+{
+    const auto position = text.find(from);
+    BOOST_REQUIRE(position != std::string::npos);
+    return text.replace(position, from.size(), to);
+}
+
+// transaction
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction__expected)
+{
+    transaction instance{};
+    BOOST_REQUIRE(from_json(instance, tx_text));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected_tx);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_whitespace__expected)
+{
+    transaction instance{};
+    BOOST_REQUIRE(from_json(instance, " \n" + replace(tx_text, "\"inputs\":",
+        "\t\"inputs\" : ") + "\n"));
+    BOOST_REQUIRE(instance == expected_tx);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_reordered__expected)
+{
+    const auto text = replace(replace(tx_text, "{\"version\":42,", "{"),
+        "\"locktime\":24}", "\"locktime\":24,\"version\":42}");
+
+    transaction instance{};
+    BOOST_REQUIRE(from_json(instance, text));
+    BOOST_REQUIRE(instance == expected_tx);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_escaped__expected)
+{
+    const auto text = replace(replace(tx_text, "\"return pick\"",
+        "\"return\\u0020pick\""), "\"sequence\"", "\"seq\\u0075ence\"");
+
+    transaction instance{};
+    BOOST_REQUIRE(from_json(instance, text));
+    BOOST_REQUIRE(instance == expected_tx);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_empty_collections__expected)
+{
+    const std::string text
+    {
+        "{\"version\":1,\"inputs\":[],\"outputs\":[],\"locktime\":2}"
+    };
+
+    const transaction expected{ 1, inputs{}, outputs{}, 2 };
+
+    transaction instance{};
+    BOOST_REQUIRE(from_json(instance, text));
+    BOOST_REQUIRE(instance == expected);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_missing_member__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, replace(tx_text, ",\"locktime\":24",
+        "")));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_duplicate_member__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, replace(tx_text, "\"locktime\":24",
+        "\"locktime\":24,\"locktime\":24")));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_unknown_member__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, replace(tx_text, "\"locktime\":24",
+        "\"locktime\":24,\"foo\":24")));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_misplaced_member__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, replace(tx_text, "\"index\":24",
+        "\"sequence\":24")));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_negative_number__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, replace(tx_text, "\"locktime\":24",
+        "\"locktime\":-24")));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_number_overflow__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, replace(tx_text, "\"locktime\":24",
+        "\"locktime\":4294967296")));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_fractional_number__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, replace(tx_text, "\"locktime\":24",
+        "\"locktime\":2.4")));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_string_number__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, replace(tx_text, "\"locktime\":24",
+        "\"locktime\":\"24\"")));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_invalid_hash__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, replace(tx_text,
+        "\"hash\":\"00", "\"hash\":\"zz")));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_invalid_script__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, replace(tx_text, "\"return pick\"",
+        "\"return foo\"")));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_array__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, "[" + tx_text + "]"));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_truncated__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, tx_text.substr(0, 42)));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transaction_trailing__false)
+{
+    transaction instance{};
+    BOOST_REQUIRE(!from_json(instance, tx_text + tx_text));
+}
+
+// transactions
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transactions__expected)
+{
+    transactions instance{};
+    BOOST_REQUIRE(from_json(instance, "[" + tx_text + "," + tx_text + "]"));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(instance.front() == expected_tx);
+    BOOST_REQUIRE(instance.back() == expected_tx);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transactions_empty__empty)
+{
+    transactions instance{ expected_tx };
+    BOOST_REQUIRE(from_json(instance, "[]"));
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__transactions_object__false)
+{
+    transactions instance{};
+    BOOST_REQUIRE(!from_json(instance, tx_text));
+}
+
+// block
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__block__expected)
+{
+    const auto text = "{\"header\":" + header_text + ",\"transactions\":[" +
+        tx_text + "," + tx_text + "]}";
+
+    const block expected{ expected_header,
+        transactions{ expected_tx, expected_tx } };
+
+    block instance{};
+    BOOST_REQUIRE(from_json(instance, text));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__block_reordered__expected)
+{
+    const auto text = "{\"transactions\":[" + tx_text + "],\"header\":" +
+        header_text + "}";
+
+    const block expected{ expected_header, transactions{ expected_tx } };
+
+    block instance{};
+    BOOST_REQUIRE(from_json(instance, text));
+    BOOST_REQUIRE(instance == expected);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__block_missing_header__false)
+{
+    block instance{};
+    BOOST_REQUIRE(!from_json(instance, "{\"transactions\":[" + tx_text +
+        "]}"));
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__from_json__block_header_array__false)
+{
+    block instance{};
+    BOOST_REQUIRE(!from_json(instance, "{\"header\":[" + header_text +
+        "],\"transactions\":[]}"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(packed_transaction_tests)
+
+using namespace system::chain;
+
+static const input::cptr input0 = to_shared<input>
+(
+    point{ one_hash, 24 },
+    script{ { { opcode::op_return }, { opcode::pick } } },
+    witness{ data_stack{ { 0x24, 0x24, 0x24 }, { 0x42, 0x42, 0x42 } } },
+    42
+);
+
+static const input::cptr input1 = to_shared<input>
+(
+    point{ null_hash, 42 },
+    script{ { { opcode::roll } } },
+    witness{},
+    24
+);
+
+static const output::cptr output0 = to_shared<output>
+(
+    24,
+    script{ { { opcode::pick } } }
+);
+
+static const output::cptr output1 = to_shared<output>
+(
+    42,
+    script{ { { opcode::op_return }, { opcode::roll } } }
+);
+
+static const transaction segregated_tx
+{
+    42,
+    to_shared(input_cptrs{ input0, input1 }),
+    to_shared(output_cptrs{ output0, output1 }),
+    24
+};
+
+static const transaction legacy_tx
+{
+    42,
+    to_shared(input_cptrs{ input1 }),
+    to_shared(output_cptrs{ output0, output1 }),
+    24
+};
+
+// constructors
+
+BOOST_AUTO_TEST_CASE(packed_transaction__constructor__default__invalid)
+{
+    const packed_transaction instance{};
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(instance.input_count(), zero);
+    BOOST_REQUIRE_EQUAL(instance.output_count(), zero);
+    BOOST_REQUIRE_EQUAL(instance.version(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.locktime(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), zero);
+    BOOST_REQUIRE_EQUAL(instance.buffer_size(), zero);
+    BOOST_REQUIRE_EQUAL(instance.hash(false), null_hash);
+    BOOST_REQUIRE_EQUAL(instance.hash(true), null_hash);
+    BOOST_REQUIRE(instance.to_data(false).empty());
+    BOOST_REQUIRE(instance.to_data(true).empty());
+    BOOST_REQUIRE(!instance.to_transaction().is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__constructor__segregated__expected)
+{
+    BOOST_REQUIRE(segregated_tx.is_segregated());
+
+    const packed_transaction instance{ segregated_tx };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(instance.version(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.locktime(), 24u);
+    BOOST_REQUIRE_EQUAL(instance.input_count(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.output_count(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__constructor__legacy__expected)
+{
+    BOOST_REQUIRE(!legacy_tx.is_segregated());
+
+    const packed_transaction instance{ legacy_tx };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(instance.version(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.locktime(), 24u);
+    BOOST_REQUIRE_EQUAL(instance.input_count(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.output_count(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__constructor__data__equals_transaction)
+{
+    const packed_transaction instance{ segregated_tx.to_data(true) };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == packed_transaction{ segregated_tx });
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__constructor__nonwitness_data__not_segregated)
+{
+    const packed_transaction instance{ segregated_tx.to_data(false) };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE(instance.input(0).witness().stack().empty());
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__constructor__trailing_data__ignored)
+{
+    auto data = segregated_tx.to_data(true);
+    data.push_back(0x42);
+    const packed_transaction instance{ data };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.to_data(true), segregated_tx.to_data(true));
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__constructor__truncated_data__invalid)
+{
+    auto data = segregated_tx.to_data(true);
+    data.pop_back();
+    const packed_transaction instance{ data };
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.hash(false), null_hash);
+    BOOST_REQUIRE(instance.to_data(false).empty());
+    BOOST_REQUIRE(!packed_transaction{ data_chunk{} }.is_valid());
+}
+
+// operators
+
+BOOST_AUTO_TEST_CASE(packed_transaction__equality__distinct__expected)
+{
+    const packed_transaction instance{ segregated_tx };
+    const packed_transaction other{ legacy_tx };
+    BOOST_REQUIRE(instance == packed_transaction{ segregated_tx });
+    BOOST_REQUIRE(instance != other);
+}
+
+// serialization
+
+BOOST_AUTO_TEST_CASE(packed_transaction__to_data__segregated__expected)
+{
+    const packed_transaction instance{ segregated_tx };
+    BOOST_REQUIRE_EQUAL(instance.to_data(true), segregated_tx.to_data(true));
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), segregated_tx.to_data(false));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), segregated_tx.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), segregated_tx.serialized_size(false));
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__to_data__legacy__expected)
+{
+    const packed_transaction instance{ legacy_tx };
+    BOOST_REQUIRE_EQUAL(instance.to_data(true), legacy_tx.to_data(true));
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), legacy_tx.to_data(false));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), legacy_tx.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), legacy_tx.serialized_size(false));
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__to_transaction__segregated__expected)
+{
+    const packed_transaction instance{ segregated_tx };
+    BOOST_REQUIRE(instance.to_transaction() == segregated_tx);
+    BOOST_REQUIRE(instance.to_transaction().is_segregated());
+}
+
+// elements
+
+BOOST_AUTO_TEST_CASE(packed_transaction__elements__segregated__expected)
+{
+    const packed_transaction instance{ segregated_tx };
+    BOOST_REQUIRE(instance.point(0) == input0->point());
+    BOOST_REQUIRE(instance.point(1) == input1->point());
+    BOOST_REQUIRE_EQUAL(instance.sequence(0), 42u);
+    BOOST_REQUIRE_EQUAL(instance.sequence(1), 24u);
+    BOOST_REQUIRE_EQUAL(instance.value(0), 24u);
+    BOOST_REQUIRE_EQUAL(instance.value(1), 42u);
+    BOOST_REQUIRE(instance.input(0) == *input0);
+    BOOST_REQUIRE(instance.input(1) == *input1);
+    BOOST_REQUIRE(instance.output(0) == *output0);
+    BOOST_REQUIRE(instance.output(1) == *output1);
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__elements__legacy__expected)
+{
+    const packed_transaction instance{ legacy_tx };
+    BOOST_REQUIRE(instance.point(0) == input1->point());
+    BOOST_REQUIRE_EQUAL(instance.sequence(0), 24u);
+    BOOST_REQUIRE(instance.input(0) == *input1);
+    BOOST_REQUIRE(instance.output(1) == *output1);
+}
+
+// hash
+
+BOOST_AUTO_TEST_CASE(packed_transaction__hash__segregated__expected)
+{
+    const packed_transaction instance{ segregated_tx };
+    BOOST_REQUIRE_EQUAL(instance.hash(false), segregated_tx.hash(false));
+    BOOST_REQUIRE_EQUAL(instance.hash(true), segregated_tx.hash(true));
+    BOOST_REQUIRE_NE(instance.hash(false), instance.hash(true));
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__hash__legacy__expected)
+{
+    const packed_transaction instance{ legacy_tx };
+    BOOST_REQUIRE_EQUAL(instance.hash(false), legacy_tx.hash(false));
+    BOOST_REQUIRE_EQUAL(instance.hash(true), legacy_tx.hash(false));
+}
+
+BOOST_AUTO_TEST_CASE(packed_transaction__hash__witness_coinbase__null_hash)
+{
+    const transaction coinbase
+    {
+        1,
+        inputs
+        {
+            {
+                point{},
+                script{ { { opcode::push_size_0 } } },
+                witness{ data_stack{ { 0x42 } } },
+                0
+            }
+        },
+        outputs{ { 42, script{} } },
+        0
+    };
+
+    const packed_transaction instance{ coinbase };
+    BOOST_REQUIRE(instance.is_coinbase());
+    BOOST_REQUIRE_EQUAL(instance.hash(true), null_hash);
+    BOOST_REQUIRE_EQUAL(instance.hash(false), coinbase.hash(false));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -140,10 +140,28 @@ public:
         return transaction::connect(ctx);
     }
 
+    code connect(const context& ctx,
+        signature_cache& signatures) const NOEXCEPT
+    {
+        return transaction::connect(ctx, &signatures);
+    }
+
     code connect(const context& ctx, uint32_t index) const NOEXCEPT
     {
         return interpreter<contiguous_stack>::connect(ctx, *this, index);
     }
+
+    code connect(const context& ctx, uint32_t index,
+        signature_cache& signatures) const NOEXCEPT
+    {
+        return interpreter<contiguous_stack>::connect(ctx, *this, index,
+            &signatures);
+    }
+
+    code connect_arena(const context& ctx, uint32_t index) const NOEXCEPT
+    {
+        return interpreter<arena_stack>::connect(ctx, *this, index);
+    }
 };
 
 transaction_accessor test_tx(const script_test& test)
@@ -586,6 +604,115 @@ BOOST_AUTO_TEST_CASE(script__context_free__invalid)
     }
 }
 
+BOOST_AUTO_TEST_CASE(script__context_free__arena_valid)
+{
+    for (const auto& test: valid_context_free_scripts)
+    {
+        const auto tx = test_tx(test);
+        const auto name = test_name(test);
+        BOOST_REQUIRE_MESSAGE(tx.is_valid(), name);
+
+        // Arena stack must produce the same results as contiguous stack.
+        BOOST_CHECK_MESSAGE(tx.connect_arena({ forks::no_rules }, 0) == error::script_success, name);
+        BOOST_CHECK_MESSAGE(tx.connect_arena({ forks::all_rules }, 0) == error::script_success, name);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__context_free__arena_invalid)
+{
+    for (const auto& test: invalid_context_free_scripts)
+    {
+        const auto tx = test_tx(test);
+        const auto name = test_name(test);
+        BOOST_REQUIRE_MESSAGE(tx.is_valid(), name);
+
+        // Arena stack must produce the same results as contiguous stack.
+        BOOST_CHECK_MESSAGE(tx.connect_arena({ forks::no_rules }, 0) != error::script_success, name);
+        BOOST_CHECK_MESSAGE(tx.connect_arena({ forks::all_rules }, 0) != error::script_success, name);
+    }
+}
+
+// Run input and then prevout script by switch and by decoded stream.
+static void check_decoded_run(const script_test& test, uint32_t forks)
+{
+    using machine = interpreter<contiguous_stack>;
+
+    const auto tx = test_tx(test);
+    const auto name = test_name(test);
+    BOOST_REQUIRE_MESSAGE(tx.is_valid(), name);
+
+    const auto input = tx.inputs_ptr()->begin();
+    const auto in_stream = machine::decode((*input)->script());
+    BOOST_REQUIRE_EQUAL(in_stream.size(), (*input)->script().ops().size());
+
+    machine expected_in(tx, input, forks);
+    machine decoded_in(tx, input, forks);
+    const auto in_ec = expected_in.run();
+    BOOST_CHECK_MESSAGE(decoded_in.run(in_stream) == in_ec, name);
+    if (in_ec)
+        return;
+
+    const auto& prevout = (*input)->prevout->script_ptr();
+    const auto out_stream = machine::decode(*prevout);
+    BOOST_REQUIRE_EQUAL(out_stream.size(), prevout->ops().size());
+
+    machine expected_out(expected_in, prevout);
+    machine decoded_out(decoded_in, prevout);
+    BOOST_CHECK_MESSAGE(decoded_out.run(out_stream) == expected_out.run(), name);
+    BOOST_CHECK_MESSAGE(decoded_out.is_true(false) == expected_out.is_true(false), name);
+}
+
+BOOST_AUTO_TEST_CASE(script__context_free__decoded_run__same_as_run)
+{
+    for (const auto& test: valid_context_free_scripts)
+    {
+        check_decoded_run(test, forks::no_rules);
+        check_decoded_run(test, forks::all_rules);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__context_free__decoded_run_invalid__same_as_run)
+{
+    for (const auto& test: invalid_context_free_scripts)
+    {
+        check_decoded_run(test, forks::no_rules);
+        check_decoded_run(test, forks::all_rules);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__decoded_run__invalid_oversized_conditional__same_as_run)
+{
+    const auto oversized = "[" + std::string(two * add1(max_push_data_size), '4') + "]";
+    const script_test_list tests
+    {
+        { "1", "verif", "executed verif" },
+        { "0", "if verif endif 1", "unexecuted verif" },
+        { "1", "if else vernotif endif 1", "unexecuted vernotif" },
+        { "1", "reserved", "executed reserved" },
+        { "0", "if reserved endif 1", "unexecuted reserved" },
+        { "reserved 1", "", "reserved first" },
+        { oversized, "1", "executed oversized push" },
+        { "0", "if " + oversized + " endif 1", "unexecuted oversized push" },
+        { "1", "if 1", "unterminated if" },
+        { "1", "notif 1", "unterminated notif" },
+        { "1", "endif 1", "endif without if" },
+        { "1", "else 1 endif", "else without if" },
+        { "1 1", "if if 1 endif", "unterminated nested if" },
+        { "1 0", "if notif 1 else 0 else 1 endif endif", "nested else else" },
+        { "1 0", "if if 1 else 0 endif endif endif", "extra endif" },
+        { "0", "if cat endif 1", "unexecuted cat" },
+        { "1", "if 1 else 2mul endif", "unexecuted 2mul" },
+        { "0", "notif 1 else mul endif", "unexecuted mul" },
+        { "0 1", "if 0 if lshift endif endif 1", "nested unexecuted lshift" }
+    };
+
+    for (const auto& test: tests)
+    {
+        check_decoded_run(test, forks::no_rules);
+        check_decoded_run(test, forks::all_rules);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(script__parse__not_invalid)
 {
     for (const auto& test: not_invalid_parse_scripts)
@@ -618,6 +745,60 @@ BOOST_AUTO_TEST_CASE(script__parse_push_overflow__invalid)
     }
 }
 
+// P2WSH spend of a witness initializing the stack with count empty elements.
+static transaction_accessor witness_stack_tx(size_t count,
+    const std::string& mnemonic)
+{
+    const script witness_script{ mnemonic };
+    const auto program = witness_script.to_data(false);
+
+    data_stack stack(count);
+    stack.push_back(program);
+
+    const transaction_accessor tx
+    {
+        1,
+        inputs
+        {
+            {
+                point{ one_hash, 0 },
+                script{},
+                witness{ stack },
+                0
+            }
+        },
+        outputs{},
+        0
+    };
+
+    tx.inputs_ptr()->front()->prevout.reset(new output{ 0u,
+        script::to_pay_witness_script_hash_pattern(sha256_hash(program)) });
+
+    return tx;
+}
+
+// A v0 witness stack is not limited until the first executed op.
+BOOST_AUTO_TEST_CASE(script__connect__witness_stack_reduced_to_limit__arena_same_as_contiguous)
+{
+    // The stack is reduced to the limit (1000) and evaluated to completion.
+    // Clean stack (bip141) is not reachable within the op count limit (201).
+    const auto tx = witness_stack_tx(add1(add1(max_stack_size)),
+        "2drop 2drop depth 998 equalverify");
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE_EQUAL(tx.connect({ forks::all_rules }, 0), error::stack_false);
+    BOOST_REQUIRE_EQUAL(tx.connect_arena({ forks::all_rules }, 0), error::stack_false);
+    BOOST_REQUIRE_EQUAL(tx.connect({ forks::all_rules }), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(script__connect__witness_stack_exceeds_arena__arena_same_as_contiguous)
+{
+    const auto tx = witness_stack_tx(two * max_stack_size, "2drop");
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE_EQUAL(tx.connect({ forks::all_rules }, 0), error::invalid_stack_size);
+    BOOST_REQUIRE_EQUAL(tx.connect_arena({ forks::all_rules }, 0), error::invalid_stack_size);
+    BOOST_REQUIRE_EQUAL(tx.connect({ forks::all_rules }), error::invalid_stack_size);
+}
+
 // Ad-hoc tx.connect tests.
 // ----------------------------------------------------------------------------
 
@@ -845,6 +1026,40 @@ BOOST_AUTO_TEST_CASE(script__verify__bip143_native_p2wpkh_tx__success)
     BOOST_REQUIRE_EQUAL(tx.connect({ forks::no_rules }, 1), error::unexpected_witness);
 }
 
+BOOST_AUTO_TEST_CASE(script__verify__bip143_native_p2wpkh_tx_signature_cache__hits)
+{
+    const auto decoded_tx = base16_chunk("01000000000102fff7f7881a8099afa6940d42d1e7f6362bec38171ea3edf433541db4e4ad969f00000000494830450221008b9d1dc26ba6a9cb62127b02742fa9d754cd3bebf337f7a55d114c8e5cdd30be022040529b194ba3f9281a99f2b1c0a19c0489bc22ede944ccf4ecbab4cc618ef3ed01eeffffffef51e1b804cc89d182d279655c3aa89e815b1b309fe287d9b2b55d57b90ec68a0100000000ffffffff02202cb206000000001976a9148280b37df378db99f66f85c95a783a76ac7a6d5988ac9093510d000000001976a9143bde42dbee7e4dbe6a21b2d50ce2f0167faa815988ac000247304402203609e17b84f6a7d30c80bfa610b5b4542f32a8a0d5447a12fb1366d7f01cc44a0220573a954c4518331561406f90300e8f3358f51928d43c212a8caed02de67eebee0121025476c2e83188368da1ff3e292e7acafcdb3566bb0ad253f62fc70f07aeee635711000000");
+    const transaction_accessor tx(decoded_tx, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE_EQUAL(tx.inputs_ptr()->size(), 2u);
+
+    constexpr auto value0 = 625000000u;
+    (*tx.inputs_ptr())[0]->prevout.reset(new output{ value0, { base16_chunk("2103c9f4836b9a4f77fc0d81f7bcb01b7f1b35916864b9476c241ce9fc198bd25432ac"), false } });
+
+    constexpr auto value1 = 600000000u;
+    (*tx.inputs_ptr())[1]->prevout.reset(new output{ value1, { base16_chunk("00141d0f172a0ecb48aee1be1f2687d2963ae33f71a1"), false } });
+
+    constexpr auto forks = forks::bip141_rule | forks::bip143_rule;
+    signature_cache cache(42);
+
+    // P2PK, verified then cached.
+    BOOST_REQUIRE_EQUAL(tx.connect({ forks }, 0, cache), error::script_success);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+    BOOST_REQUIRE_EQUAL(tx.connect({ forks }, 0, cache), error::script_success);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+
+    // P2WPKH witness program, verified then cached.
+    BOOST_REQUIRE_EQUAL(tx.connect({ forks }, 1, cache), error::script_success);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 2u);
+    BOOST_REQUIRE_EQUAL(tx.connect({ forks }, 1, cache), error::script_success);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 2u);
+
+    // Transaction connect passes the cache to each input.
+    BOOST_REQUIRE_EQUAL(tx.connect({ forks }, cache), error::script_success);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 2u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 4u);
+}
+
 BOOST_AUTO_TEST_CASE(script__verify__bip143_p2sh_p2wpkh_tx__success)
 {
     const auto decoded_tx = base16_chunk("01000000000101db6b1b20aa0fd7b23880be2ecbd4a98130974cf4748fb66092ac4d3ceb1a5477010000001716001479091972186c449eb1ded22b78e40d009bdf0089feffffff02b8b4eb0b000000001976a914a457b684d7f0d539a46a45bbc043f35b59d0d96388ac0008af2f000000001976a914fd270b1ee6abcaea97fea7ad0402e8bd8ad6d77c88ac02473044022047ac8e878352d3ebbde1c94ce3a10d057c24175747116f8288e5d794d12d482f0220217f36a485cae903c713331d877c1f64677e3622ad4010726870540656fe9dcb012103ad1d8e89212f0b92c74d23bb710c00662ad1470198ac48c43f7d6f93a2a2687392040000");
@@ -539,6 +539,20 @@ BOOST_AUTO_TEST_CASE(transaction__hash__block320670__success)
     BOOST_REQUIRE_EQUAL(instance.to_data(true), tx4_data);
 }
 
+BOOST_AUTO_TEST_CASE(transaction__is_hashed__set_hashes__expected)
+{
+    const transaction instance(tx4_data, true);
+    BOOST_REQUIRE(!instance.is_hashed(false));
+    BOOST_REQUIRE(!instance.is_hashed(true));
+
+    instance.set_hash(hash_digest{ tx4_hash });
+    BOOST_REQUIRE(instance.is_hashed(false));
+    BOOST_REQUIRE(!instance.is_hashed(true));
+
+    instance.set_witness_hash(hash_digest{ tx4_hash });
+    BOOST_REQUIRE(instance.is_hashed(true));
+}
+
 BOOST_AUTO_TEST_CASE(transaction__is_coinbase__empty__false)
 {
     transaction instance;
@@ -706,6 +720,93 @@ BOOST_AUTO_TEST_CASE(transaction__signature_operations__empty_input_output__zero
 // accept
 // connect
 
+// Each input spends a prevout whose script either succeeds or fails.
+static transaction connectable(const std_vector<bool>& succeeds)
+{
+    const script pass{ operations{ { opcode::push_positive_1 } } };
+    const script fail{ operations{ { opcode::op_return } } };
+
+    inputs ins{};
+    for (uint32_t index = 0; index < succeeds.size(); ++index)
+    {
+        ins.emplace_back(point{ tx1_hash, index }, script{}, 0u);
+        ins.back().prevout = to_shared<output>(42, succeeds[index] ? pass : fail);
+    }
+
+    return { 1, std::move(ins), outputs{ { 42, script{} } }, 0 };
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__cache_miss__scripts_run_and_cached)
+{
+    context ctx{};
+    ctx.forks = forks::bip16_rule;
+    const auto tx = connectable({ true, true });
+    const auto key = tx.hash(true);
+    machine::verification_cache cache(42);
+
+    BOOST_REQUIRE(!tx.connect(ctx, cache));
+    BOOST_REQUIRE_EQUAL(cache.misses(), 2u);
+    BOOST_REQUIRE_EQUAL(cache.size(), 2u);
+    BOOST_REQUIRE(cache.contains(key, 0, ctx.forks));
+    BOOST_REQUIRE(cache.contains(key, 1, ctx.forks));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__cache_hit__scripts_skipped)
+{
+    context ctx{};
+    ctx.forks = forks::bip16_rule;
+    const auto tx = connectable({ false });
+    machine::verification_cache cache(42);
+    BOOST_REQUIRE(tx.connect(ctx, cache));
+
+    // A cached (failing) input is not evaluated, so connect succeeds.
+    cache.insert(tx.hash(true), 0, ctx.forks);
+    BOOST_REQUIRE(!tx.connect(ctx, cache));
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__cache_other_forks__scripts_run)
+{
+    context ctx{};
+    ctx.forks = forks::bip16_rule;
+    const auto tx = connectable({ false });
+    machine::verification_cache cache(42);
+    cache.insert(tx.hash(true), 0, forks::no_rules);
+
+    BOOST_REQUIRE(tx.connect(ctx, cache));
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__cache_other_index__scripts_run)
+{
+    context ctx{};
+    ctx.forks = forks::bip16_rule;
+    const auto tx = connectable({ false, true });
+    machine::verification_cache cache(42);
+    cache.insert(tx.hash(true), 1, ctx.forks);
+
+    BOOST_REQUIRE(tx.connect(ctx, cache));
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__cache_failure__not_cached)
+{
+    context ctx{};
+    ctx.forks = forks::bip16_rule;
+    const auto tx = connectable({ true, false });
+    const auto key = tx.hash(true);
+    machine::verification_cache cache(42);
+
+    BOOST_REQUIRE(tx.connect(ctx, cache));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+    BOOST_REQUIRE(cache.contains(key, 0, ctx.forks));
+    BOOST_REQUIRE(!cache.contains(key, 1, ctx.forks));
+
+    // The failure is reproduced, not served from the cache.
+    BOOST_REQUIRE(tx.connect(ctx, cache));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+}
+
 // validation (protected)
 // ----------------------------------------------------------------------------
 
@@ -1539,6 +1640,12 @@ BOOST_AUTO_TEST_CASE(transaction__json__conversions__expected)
 
     BOOST_REQUIRE(json::value_from(instance) == value);
     BOOST_REQUIRE(json::value_to<chain::transaction>(value) == instance);
+
+    std::ostringstream stream;
+    props_writer writer(stream, props::format::json);
+    chain::to_props(writer, instance);
+    BOOST_REQUIRE(writer.is_complete());
+    BOOST_REQUIRE_EQUAL(stream.str(), text);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,281 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(transaction_builder_tests)
+
+using namespace system::chain;
+
+static const input::cptr input0 = to_shared<input>
+(
+    point{ one_hash, 24 },
+    script{ { { opcode::op_return }, { opcode::pick } } },
+    witness{ data_stack{ { 0x24, 0x24, 0x24 }, { 0x42, 0x42, 0x42 } } },
+    42
+);
+
+static const input::cptr input1 = to_shared<input>
+(
+    point{ null_hash, 42 },
+    script{ { { opcode::roll } } },
+    witness{},
+    24
+);
+
+static const output::cptr output0 = to_shared<output>
+(
+    24,
+    script{ { { opcode::pick } } }
+);
+
+static const output::cptr output1 = to_shared<output>
+(
+    42,
+    script{ { { opcode::op_return }, { opcode::roll } } }
+);
+
+static const transaction expected_tx
+{
+    42,
+    to_shared(input_cptrs{ input0, input1 }),
+    to_shared(output_cptrs{ output0, output1 }),
+    24
+};
+
+// Transaction computed without any cached state.
+static transaction reference(const transaction_builder& instance)
+{
+    return
+    {
+        instance.version(),
+        to_shared(instance.inputs()),
+        to_shared(instance.outputs()),
+        instance.locktime()
+    };
+}
+
+static bool hashes_match(const transaction_builder& instance)
+{
+    const auto tx = reference(instance);
+    return instance.hash(false) == tx.hash(false)
+        && instance.hash(true) == tx.hash(true)
+        && instance.outputs_hash() == tx.outputs_hash()
+        && instance.points_hash() == tx.points_hash()
+        && instance.sequences_hash() == tx.sequences_hash();
+}
+
+// constructors
+
+BOOST_AUTO_TEST_CASE(transaction_builder__construct__transaction__shared_elements)
+{
+    const transaction_builder instance{ expected_tx };
+    BOOST_REQUIRE_EQUAL(instance.version(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.locktime(), 24u);
+    BOOST_REQUIRE(instance.inputs() == *expected_tx.inputs_ptr());
+    BOOST_REQUIRE(instance.outputs() == *expected_tx.outputs_ptr());
+    BOOST_REQUIRE(instance.is_segregated());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__construct__empty__expected)
+{
+    const transaction_builder instance{ 1, 2 };
+    BOOST_REQUIRE_EQUAL(instance.version(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.locktime(), 2u);
+    BOOST_REQUIRE(instance.inputs().empty());
+    BOOST_REQUIRE(instance.outputs().empty());
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE(hashes_match(instance));
+}
+
+// hashes
+
+BOOST_AUTO_TEST_CASE(transaction_builder__hash__witness__transaction_hashes)
+{
+    const transaction_builder instance{ expected_tx };
+    BOOST_REQUIRE(instance.hash(false) == expected_tx.hash(false));
+    BOOST_REQUIRE(instance.hash(true) == expected_tx.hash(true));
+    BOOST_REQUIRE(instance.hash(false) != instance.hash(true));
+    BOOST_REQUIRE(hashes_match(instance));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__hash__unwitnessed__hashes_equal)
+{
+    transaction_builder instance{ expected_tx };
+    instance.erase_input(0);
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE(instance.hash(false) == instance.hash(true));
+    BOOST_REQUIRE(hashes_match(instance));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__hash__witness_coinbase__null_hash)
+{
+    transaction_builder instance{ 1, 0 };
+    instance.push_input(to_shared<input>(point{}, script{},
+        witness{ "[42]" }, 0));
+
+    BOOST_REQUIRE(instance.hash(true) == null_hash);
+    BOOST_REQUIRE(instance.hash(false) == reference(instance).hash(false));
+}
+
+// edits
+
+BOOST_AUTO_TEST_CASE(transaction_builder__set_version__hashed__expected)
+{
+    transaction_builder instance{ expected_tx };
+    BOOST_REQUIRE(hashes_match(instance));
+    instance.set_version(7);
+    BOOST_REQUIRE_EQUAL(instance.version(), 7u);
+    BOOST_REQUIRE(hashes_match(instance));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__set_locktime__hashed__expected)
+{
+    transaction_builder instance{ expected_tx };
+    BOOST_REQUIRE(hashes_match(instance));
+    instance.set_locktime(7);
+    BOOST_REQUIRE_EQUAL(instance.locktime(), 7u);
+    BOOST_REQUIRE(hashes_match(instance));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__set_sequence__hashed__expected)
+{
+    transaction_builder instance{ expected_tx };
+    BOOST_REQUIRE(hashes_match(instance));
+    instance.set_sequence(1, 7);
+    BOOST_REQUIRE_EQUAL(instance.inputs()[1]->sequence(), 7u);
+    BOOST_REQUIRE(instance.inputs()[1]->script_ptr() == input1->script_ptr());
+    BOOST_REQUIRE(hashes_match(instance));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__set_sequence__source__unchanged)
+{
+    transaction_builder instance{ expected_tx };
+    instance.set_sequence(0, 7);
+    BOOST_REQUIRE_EQUAL(expected_tx.inputs_ptr()->front()->sequence(), 42u);
+    BOOST_REQUIRE_EQUAL(input0->sequence(), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__set_value__hashed__expected)
+{
+    transaction_builder instance{ expected_tx };
+    BOOST_REQUIRE(hashes_match(instance));
+    instance.set_value(0, 7);
+    BOOST_REQUIRE_EQUAL(instance.outputs()[0]->value(), 7u);
+    BOOST_REQUIRE_EQUAL(output0->value(), 24u);
+    BOOST_REQUIRE(hashes_match(instance));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__set_input__hashed__expected)
+{
+    transaction_builder instance{ expected_tx };
+    BOOST_REQUIRE(hashes_match(instance));
+    instance.set_input(0, input1);
+    BOOST_REQUIRE(instance.inputs()[0] == input1);
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE(hashes_match(instance));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__set_output__hashed__expected)
+{
+    transaction_builder instance{ expected_tx };
+    BOOST_REQUIRE(hashes_match(instance));
+    instance.set_output(1, output0);
+    BOOST_REQUIRE(instance.outputs()[1] == output0);
+    BOOST_REQUIRE(hashes_match(instance));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__push_erase__hashed__expected)
+{
+    transaction_builder instance{ expected_tx };
+    BOOST_REQUIRE(hashes_match(instance));
+    instance.push_input(input0);
+    BOOST_REQUIRE(hashes_match(instance));
+    instance.push_output(output1);
+    BOOST_REQUIRE(hashes_match(instance));
+    instance.erase_input(0);
+    BOOST_REQUIRE(hashes_match(instance));
+    instance.erase_output(0);
+    BOOST_REQUIRE(hashes_match(instance));
+    BOOST_REQUIRE_EQUAL(instance.inputs().size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.outputs().size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__edits__random__expected)
+{
+    transaction_builder instance{ expected_tx };
+    for (uint32_t round = 0; round < 200u; ++round)
+    {
+        const auto inputs = instance.inputs().size();
+        const auto outputs = instance.outputs().size();
+        const auto value = round;
+
+        switch (round % 9u)
+        {
+            case 0: instance.set_version(value); break;
+            case 1: instance.set_locktime(value); break;
+            case 2: instance.set_sequence(value % inputs, value); break;
+            case 3: instance.set_value(value % outputs, value); break;
+            case 4: instance.push_input(value % 2 ? input0 : input1); break;
+            case 5: instance.push_output(value % 2 ? output0 : output1); break;
+            case 6: instance.set_input(value % inputs, input1); break;
+            case 7: if (inputs > 1u) instance.erase_input(value % inputs); break;
+            case 8: if (outputs > 1u) instance.erase_output(value % outputs); break;
+        }
+
+        // Skip hashing some rounds so that changes accumulate.
+        if (round % 3u != 1u)
+            BOOST_REQUIRE(hashes_match(instance));
+    }
+}
+
+// to_transaction
+
+BOOST_AUTO_TEST_CASE(transaction_builder__to_transaction__edited__expected)
+{
+    transaction_builder instance{ expected_tx };
+    instance.set_value(1, 7);
+    instance.set_sequence(0, 7);
+
+    const auto tx = instance.to_transaction();
+    const auto expected = reference(instance);
+    BOOST_REQUIRE(tx == expected);
+    BOOST_REQUIRE(tx != expected_tx);
+    BOOST_REQUIRE(tx.inputs_ptr()->back() == expected_tx.inputs_ptr()->back());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_builder__to_transaction__hashed__cached_hashes)
+{
+    transaction_builder instance{ expected_tx };
+    instance.set_locktime(7);
+    BOOST_REQUIRE(hashes_match(instance));
+
+    const auto tx = instance.to_transaction();
+    const auto expected = reference(instance);
+    BOOST_REQUIRE(tx.hash(false) == expected.hash(false));
+    BOOST_REQUIRE(tx.hash(true) == expected.hash(true));
+
+    const auto input = std::next(tx.inputs_ptr()->begin());
+    const auto expected_input = std::next(expected.inputs_ptr()->begin());
+    const script sub{ { { opcode::pick } } };
+    BOOST_REQUIRE(tx.signature_hash(input, sub, 42, coverage::hash_all,
+        script_version::zero, true) == expected.signature_hash(expected_input,
+        sub, 42, coverage::hash_all, script_version::zero, true));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
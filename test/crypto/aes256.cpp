@@ -54,4 +54,63 @@ BOOST_AUTO_TEST_CASE(encryption__aes256__nist__expected)
     BOOST_REQUIRE_EQUAL(block, plaintext);
 }
 
+BOOST_AUTO_TEST_CASE(encryption__aes256__blocks_nist__expected)
+{
+    constexpr auto key = base16_array("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    constexpr auto plaintext = base16_array("00112233445566778899aabbccddeeff");
+    constexpr auto cypertext = base16_array("8ea2b7ca516745bfeafc49904b496089");
+
+    // Covers the eight and four block interleaved paths and the remainder.
+    for (size_t count = 0; count < 20; ++count)
+    {
+        aes256::blocks blocks(count, plaintext);
+
+        aes256::encrypt(blocks, key);
+        for (const auto& block: blocks)
+            BOOST_REQUIRE_EQUAL(block, cypertext);
+
+        aes256::decrypt(blocks, key);
+        for (const auto& block: blocks)
+            BOOST_REQUIRE_EQUAL(block, plaintext);
+    }
+}
+
+// nvlpubs.nist.gov/nistpubs/Legacy/SP/nistspecialpublication800-38a.pdf
+// F.1.5 ECB-AES256.Encrypt
+BOOST_AUTO_TEST_CASE(encryption__aes256__blocks_distinct_nist__expected)
+{
+    constexpr auto key = base16_array("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4");
+    constexpr std_array<aes256::block, 4> plaintexts
+    {
+        base16_array("6bc1bee22e409f96e93d7e117393172a"),
+        base16_array("ae2d8a571e03ac9c9eb76fac45af8e51"),
+        base16_array("30c81c46a35ce411e5fbc1191a0a52ef"),
+        base16_array("f69f2445df4f9b17ad2b417be66c3710")
+    };
+    constexpr std_array<aes256::block, 4> cyphertexts
+    {
+        base16_array("f3eed1bdb5d2a03c064b5a7e3db181f8"),
+        base16_array("591ccb10d410ed26dc5ba74a31362870"),
+        base16_array("b6ed21b99ca6f4f9f153e7b1beafed1d"),
+        base16_array("23304b7a39f9f3ff067d8d8f9e24ecc7")
+    };
+
+    // Distinct lanes cover the eight and four block interleaved paths
+    // against published vectors, independent of the single block path.
+    for (size_t count = 0; count < 20; ++count)
+    {
+        aes256::blocks blocks(count);
+        for (size_t index = 0; index < count; ++index)
+            blocks[index] = plaintexts[index % plaintexts.size()];
+
+        aes256::encrypt(blocks, key);
+        for (size_t index = 0; index < count; ++index)
+            BOOST_REQUIRE_EQUAL(blocks[index], cyphertexts[index % cyphertexts.size()]);
+
+        aes256::decrypt(blocks, key);
+        for (size_t index = 0; index < count; ++index)
+            BOOST_REQUIRE_EQUAL(blocks[index], plaintexts[index % plaintexts.size()]);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
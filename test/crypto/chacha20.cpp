@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(chacha20_tests)
+
+// datatracker.ietf.org/doc/html/rfc8439#appendix-A.1 (test vector #1)
+BOOST_AUTO_TEST_CASE(chacha20__generate__zero_key_zero_counter__expected)
+{
+    const auto expected = base16_array("76b8e0ada0f13d90405d6ae55386bd28bdd219b8a08ded1aa836efcc8b770dc7da41597c5157488d7724e03fb8d84a376a43b8f41518a11cc387b669b2ee6586");
+    chacha20 cipher{ {} };
+    chacha20::block block{};
+    cipher.generate(block);
+    BOOST_REQUIRE_EQUAL(block, expected);
+}
+
+// datatracker.ietf.org/doc/html/rfc8439#appendix-A.1 (test vector #2)
+BOOST_AUTO_TEST_CASE(chacha20__generate__second_block__expected)
+{
+    const auto expected = base16_array("9f07e7be5551387a98ba977c732d080dcb0f29a048e3656912c6533e32ee7aed29b721769ce64e43d57133b074d839d531ed1f28510afb45ace10a1f4b794d6f");
+    chacha20 cipher{ {} };
+    chacha20::block block{};
+    cipher.generate(block);
+    cipher.generate(block);
+    BOOST_REQUIRE_EQUAL(block, expected);
+}
+
+// datatracker.ietf.org/doc/html/rfc8439#section-2.3.2
+// IETF counter (1) and first nonce word (0x09000000) form the 64 bit counter.
+BOOST_AUTO_TEST_CASE(chacha20__generate__rfc8439_block__expected)
+{
+    const auto key = base16_array("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    const auto expected = base16_array("10f1e7e4d13b5915500fdd1fa32071c4c7d1f4c733c068030422aa9ac3d46c4ed2826446079faa0914c2d705d98b02a2b5129cd1de164eb9cbd083e8a2503c4e");
+    chacha20 cipher{ key, 0x000000004a000000, 0x0900000000000001 };
+    chacha20::block block{};
+    cipher.generate(block);
+    BOOST_REQUIRE_EQUAL(block, expected);
+}
+
+BOOST_AUTO_TEST_CASE(chacha20__generate__slab__whole_blocks_only)
+{
+    chacha20 blocks{ {} };
+    chacha20 single{ {} };
+    data_chunk out(3 * chacha20::block_size + 10, 0xff);
+    BOOST_REQUIRE_EQUAL(blocks.generate(out), 3 * chacha20::block_size);
+
+    chacha20::block block{};
+    for (size_t index = 0; index < 3; ++index)
+    {
+        single.generate(block);
+        BOOST_REQUIRE(std::equal(block.begin(), block.end(),
+            std::next(out.begin(), index * chacha20::block_size)));
+    }
+
+    BOOST_REQUIRE_EQUAL(out.back(), 0xff);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -124,6 +124,15 @@ BOOST_AUTO_TEST_CASE(ring_signature__verify__valid__round_trip)
     BOOST_REQUIRE(verify(valid_public_rings, valid_digest, signature));
 }
 
+BOOST_AUTO_TEST_CASE(ring_signature__verify__short_ring_proofs__false)
+{
+    ring_signature signature;
+    signature.proofs = valid_proofs;
+    BOOST_REQUIRE(sign(signature, valid_secrets, valid_public_rings, valid_digest, valid_salts));
+    signature.proofs[1].pop_back();
+    BOOST_REQUIRE(!verify(valid_public_rings, valid_digest, signature));
+}
+
 const hash_digest negative_digest
 {
     0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff,
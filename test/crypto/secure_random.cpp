@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(secure_random_tests)
+
+BOOST_AUTO_TEST_CASE(secure_random__fill__array__not_zero)
+{
+    hash_digest first{};
+    hash_digest second{};
+    secure_random::fill(first);
+    secure_random::fill(second);
+    BOOST_REQUIRE(first != null_hash);
+    BOOST_REQUIRE(first != second);
+}
+
+BOOST_AUTO_TEST_CASE(secure_random__fill__bulk_and_partial__distinct)
+{
+    // Spans buffered, bulk and partial paths.
+    data_chunk first(5000);
+    data_chunk second(5000);
+    secure_random::fill(first);
+    secure_random::fill(second);
+    BOOST_REQUIRE(first != second);
+
+    // Byte frequencies of 10000 random bytes are within a loose bound.
+    std_array<size_t, 256> counts{};
+    for (const auto byte: splice(first, second))
+        ++counts[byte];
+
+    for (const auto count: counts)
+        BOOST_REQUIRE(count < 100u);
+}
+
+BOOST_AUTO_TEST_CASE(secure_random__fill__empty__empty)
+{
+    data_chunk empty{};
+    secure_random::fill(empty);
+    BOOST_REQUIRE(empty.empty());
+}
+
+BOOST_AUTO_TEST_CASE(secure_random__next__range__within_range)
+{
+    BOOST_REQUIRE(is_zero(secure_random::next(2, 1)));
+    BOOST_REQUIRE_EQUAL(secure_random::next(42, 42), 42u);
+
+    std_array<bool, 7> seen{};
+    for (size_t count = 0; count < 1000; ++count)
+    {
+        const auto value = secure_random::next(10, 16);
+        BOOST_REQUIRE(value >= 10u && value <= 16u);
+        seen[value - 10u] = true;
+    }
+
+    for (const auto value: seen)
+        BOOST_REQUIRE(value);
+}
+
+BOOST_AUTO_TEST_CASE(secure_random__reseed__fill__not_zero)
+{
+    secure_random::reseed();
+    hash_digest value{};
+    secure_random::fill(value);
+    BOOST_REQUIRE(value != null_hash);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(signature_cache_tests)
+
+const hash_digest salt = base16_hash("0102030405060708091011121314151617181920212223242526272829303132");
+const ec_secret secret = base16_array("8010b1bb119ad37d4b65a1022a314897b1b3614b345974332cb1b9582cf03536");
+const hash_digest sighash = base16_hash("f89572635651b2e4f89778350616989183c98d1a721c911324bf9f17a0cf5bf0");
+
+BOOST_AUTO_TEST_CASE(signature_cache__construct__capacity__expected)
+{
+    const signature_cache cache(42, 3, salt);
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 42u);
+    BOOST_REQUIRE_EQUAL(cache.kicks(), 3u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.evictions(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__verify__valid__true_then_hit)
+{
+    ec_compressed point;
+    ec_signature signature;
+    BOOST_REQUIRE(secret_to_public(point, secret));
+    BOOST_REQUIRE(sign(signature, secret, sighash));
+
+    signature_cache cache(42);
+    BOOST_REQUIRE(cache.verify(point, sighash, signature));
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+
+    BOOST_REQUIRE(cache.verify(point, sighash, signature));
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__verify__invalid__false_not_cached)
+{
+    ec_compressed point;
+    ec_signature signature;
+    BOOST_REQUIRE(secret_to_public(point, secret));
+    BOOST_REQUIRE(sign(signature, secret, sighash));
+    signature.front() ^= 0xff;
+
+    signature_cache cache(42);
+    BOOST_REQUIRE(!cache.verify(point, sighash, signature));
+    BOOST_REQUIRE(!cache.contains(point, sighash, signature));
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__insert__contains__true)
+{
+    const ec_signature signature{ 42 };
+    signature_cache cache(42, 8, salt);
+    cache.insert(ec_compressed_generator, sighash, signature);
+    BOOST_REQUIRE(cache.contains(ec_compressed_generator, sighash, signature));
+    BOOST_REQUIRE(!cache.contains(ec_uncompressed_generator, sighash, signature));
+    BOOST_REQUIRE(!cache.contains(ec_compressed_generator, salt, signature));
+    BOOST_REQUIRE(!cache.contains(ec_compressed_generator, sighash, {}));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__insert__zero_capacity__not_cached)
+{
+    const ec_signature signature{ 42 };
+    signature_cache cache(0, 8, salt);
+    cache.insert(ec_compressed_generator, sighash, signature);
+    BOOST_REQUIRE(!cache.contains(ec_compressed_generator, sighash, signature));
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__insert__full__evicts)
+{
+    signature_cache cache(1, 0, salt);
+    cache.insert(ec_compressed_generator, sighash, { 1 });
+    cache.insert(ec_compressed_generator, sighash, { 2 });
+    BOOST_REQUIRE_EQUAL(cache.evictions(), 1u);
+    BOOST_REQUIRE(!cache.contains(ec_compressed_generator, sighash, { 1 }));
+    BOOST_REQUIRE(cache.contains(ec_compressed_generator, sighash, { 2 }));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__insert__kicks__retains_all)
+{
+    // Each entry has at most two slots, so four entries fit in eight slots
+    // given enough displacements (unless hashing maps three to two slots).
+    signature_cache cache(8, 32, salt);
+    for (uint8_t value = 0; value < 4; ++value)
+        cache.insert(ec_compressed_generator, sighash, { value });
+
+    size_t found{};
+    for (uint8_t value = 0; value < 4; ++value)
+        found += to_int<size_t>(cache.contains(ec_compressed_generator, sighash, { value }));
+
+    BOOST_REQUIRE_EQUAL(found + cache.evictions(), 4u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
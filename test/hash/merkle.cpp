@@ -0,0 +1,255 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(merkle_tests)
+
+static hashes leaves(size_t count)
+{
+    hashes out{};
+    for (auto index = zero; index < count; ++index)
+        out.push_back(sha256_hash(to_little_endian(index)));
+
+    return out;
+}
+
+// construct
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(merkle__construct__empty__null_root)
+{
+    const merkle_tree instance{ hashes{} };
+    BOOST_REQUIRE_EQUAL(instance.root(), null_hash);
+    BOOST_REQUIRE_EQUAL(instance.leaves(), zero);
+    BOOST_REQUIRE_EQUAL(instance.depth(), zero);
+    BOOST_REQUIRE(instance.prove(0).branch.empty());
+    BOOST_REQUIRE(instance.prune({ true }).nodes.empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle__construct__one__leaf_root)
+{
+    const auto items = leaves(1);
+    const merkle_tree instance{ items };
+    BOOST_REQUIRE_EQUAL(instance.root(), items.front());
+    BOOST_REQUIRE_EQUAL(instance.leaves(), one);
+    BOOST_REQUIRE_EQUAL(instance.depth(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(merkle__construct__counts__merkle_root)
+{
+    for (auto count = one; count <= 33u; ++count)
+    {
+        auto items = leaves(count);
+        const merkle_tree instance{ items };
+        BOOST_REQUIRE_EQUAL(instance.root(), sha256::merkle_root(std::move(items)));
+        BOOST_REQUIRE_EQUAL(instance.leaves(), count);
+        BOOST_REQUIRE_EQUAL(instance.depth(), ceilinged_log2(sub1(count)));
+    }
+}
+
+// prove/verify
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(merkle__prove__all_leaves__verify)
+{
+    for (auto count = one; count <= 33u; ++count)
+    {
+        const auto items = leaves(count);
+        const merkle_tree instance{ items };
+
+        for (auto index = zero; index < count; ++index)
+        {
+            const auto proof = instance.prove(index);
+            BOOST_REQUIRE_EQUAL(proof.index, index);
+            BOOST_REQUIRE_EQUAL(proof.branch.size(), instance.depth());
+            BOOST_REQUIRE_EQUAL(merkle_tree::root(items[index], proof), instance.root());
+            BOOST_REQUIRE(merkle_tree::verify(instance.root(), items[index], proof));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle__prove__out_of_range__empty_branch)
+{
+    const merkle_tree instance{ leaves(5) };
+    const auto proof = instance.prove(5);
+    BOOST_REQUIRE_EQUAL(proof.index, 5u);
+    BOOST_REQUIRE(proof.branch.empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle__verify__wrong_leaf__false)
+{
+    const auto items = leaves(7);
+    const merkle_tree instance{ items };
+    BOOST_REQUIRE(!merkle_tree::verify(instance.root(), items[3], instance.prove(2)));
+}
+
+BOOST_AUTO_TEST_CASE(merkle__verify__index_beyond_branch__false)
+{
+    const auto items = leaves(4);
+    const merkle_tree instance{ items };
+    auto proof = instance.prove(1);
+    proof.index += 4u;
+    BOOST_REQUIRE_EQUAL(merkle_tree::root(items[1], proof), instance.root());
+    BOOST_REQUIRE(!merkle_tree::verify(instance.root(), items[1], proof));
+}
+
+BOOST_AUTO_TEST_CASE(merkle__prove__indexes__batch_verify)
+{
+    const auto items = leaves(21);
+    const merkle_tree instance{ items };
+    const std::vector<size_t> indexes{ 20, 0, 7, 8, 7, 13 };
+    const auto proofs = instance.prove(indexes);
+    BOOST_REQUIRE_EQUAL(proofs.size(), indexes.size());
+
+    hashes proven{};
+    for (const auto index: indexes)
+        proven.push_back(items[index]);
+
+    BOOST_REQUIRE(merkle_tree::verify(instance.root(), proven, proofs));
+
+    proven[2] = items[6];
+    BOOST_REQUIRE(!merkle_tree::verify(instance.root(), proven, proofs));
+}
+
+BOOST_AUTO_TEST_CASE(merkle__verify__batch_mismatched_or_empty__false)
+{
+    const auto items = leaves(3);
+    const merkle_tree instance{ items };
+    const auto proofs = instance.prove(std::vector<size_t>{ 0, 1 });
+    BOOST_REQUIRE(!merkle_tree::verify(instance.root(), hashes{ items[0] }, proofs));
+    BOOST_REQUIRE(!merkle_tree::verify(instance.root(), hashes{}, merkle_tree::proofs{}));
+}
+
+BOOST_AUTO_TEST_CASE(merkle__prove__leaves__expected_indexes)
+{
+    const auto items = leaves(9);
+    const merkle_tree instance{ items };
+
+    merkle_tree::proofs proofs{};
+    BOOST_REQUIRE(instance.prove(proofs, { items[8], items[3] }));
+    BOOST_REQUIRE_EQUAL(proofs.size(), two);
+    BOOST_REQUIRE_EQUAL(proofs[0].index, 8u);
+    BOOST_REQUIRE_EQUAL(proofs[1].index, 3u);
+    BOOST_REQUIRE(merkle_tree::verify(instance.root(), { items[8], items[3] }, proofs));
+}
+
+BOOST_AUTO_TEST_CASE(merkle__prove__missing_leaf__false)
+{
+    const merkle_tree instance{ leaves(9) };
+    merkle_tree::proofs proofs{};
+    BOOST_REQUIRE(!instance.prove(proofs, { null_hash }));
+}
+
+// prune/verify (bip37)
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(merkle__prune__match_patterns__extracts_matches)
+{
+    for (auto count = one; count <= 17u; ++count)
+    {
+        const auto items = leaves(count);
+        const merkle_tree instance{ items };
+
+        // Every third leaf offset by count, and none.
+        for (const auto step: { 3u, 0u })
+        {
+            std::vector<bool> matches(count);
+            hashes expected{};
+            std::vector<size_t> expected_indexes{};
+
+            for (auto index = zero; step != 0u && index < count; ++index)
+            {
+                matches[index] = is_zero((index + count) % step);
+                if (matches[index])
+                {
+                    expected.push_back(items[index]);
+                    expected_indexes.push_back(index);
+                }
+            }
+
+            const auto tree = instance.prune(matches);
+            BOOST_REQUIRE_EQUAL(tree.leaves, count);
+
+            hashes extracted{};
+            std::vector<size_t> indexes{};
+            BOOST_REQUIRE(merkle_tree::verify(instance.root(), tree, extracted, indexes));
+            BOOST_REQUIRE_EQUAL(extracted, expected);
+            BOOST_REQUIRE_EQUAL(indexes, expected_indexes);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle__prune__no_matches__root_only)
+{
+    const merkle_tree instance{ leaves(6) };
+    const auto tree = instance.prune({});
+    BOOST_REQUIRE_EQUAL(tree.nodes.size(), one);
+    BOOST_REQUIRE_EQUAL(tree.nodes.front(), instance.root());
+    BOOST_REQUIRE_EQUAL(tree.flags.size(), one);
+}
+
+BOOST_AUTO_TEST_CASE(merkle__verify__partial_wrong_root__false)
+{
+    const merkle_tree instance{ leaves(6) };
+    const auto tree = instance.prune({ false, true });
+
+    hashes matches{};
+    std::vector<size_t> indexes{};
+    BOOST_REQUIRE(!merkle_tree::verify(null_hash, tree, matches, indexes));
+}
+
+BOOST_AUTO_TEST_CASE(merkle__verify__partial_malformed__false)
+{
+    const merkle_tree instance{ leaves(6) };
+    const auto tree = instance.prune({ false, true });
+
+    hashes matches{};
+    std::vector<size_t> indexes{};
+    auto extra_node = tree;
+    extra_node.nodes.push_back(null_hash);
+    BOOST_REQUIRE(!merkle_tree::verify(instance.root(), extra_node, matches, indexes));
+
+    auto missing_node = tree;
+    missing_node.nodes.pop_back();
+    BOOST_REQUIRE(!merkle_tree::verify(instance.root(), missing_node, matches, indexes));
+
+    auto extra_flags = tree;
+    extra_flags.flags.resize(tree.flags.size() + byte_bits, false);
+    BOOST_REQUIRE(!merkle_tree::verify(instance.root(), extra_flags, matches, indexes));
+
+    auto empty = tree;
+    empty.leaves = zero;
+    BOOST_REQUIRE(!merkle_tree::verify(instance.root(), empty, matches, indexes));
+}
+
+BOOST_AUTO_TEST_CASE(merkle__verify__partial_duplicated_subtree__false)
+{
+    // Trailing duplicate leaf produces the root of the three leaf tree.
+    auto items = leaves(3);
+    items.push_back(items.back());
+    const merkle_tree instance{ items };
+    BOOST_REQUIRE_EQUAL(instance.root(), merkle_tree{ leaves(3) }.root());
+
+    hashes matches{};
+    std::vector<size_t> indexes{};
+    const auto tree = instance.prune({ false, false, false, true });
+    BOOST_REQUIRE(!merkle_tree::verify(instance.root(), tree, matches, indexes));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(verification_cache_tests)
+
+using namespace bc::system::machine;
+
+static const hash_digest salt = base16_array("0102030405060708091011121314151617181920212223242526272829303132");
+static const hash_digest hash1 = base16_array("1111111111111111111111111111111111111111111111111111111111111111");
+static const hash_digest hash2 = base16_array("2222222222222222222222222222222222222222222222222222222222222222");
+
+BOOST_AUTO_TEST_CASE(verification_cache__construct__capacity__empty)
+{
+    const verification_cache cache(42, salt);
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 42u);
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(verification_cache__contains__empty__false_miss)
+{
+    const verification_cache cache(42);
+    BOOST_REQUIRE(!cache.contains(hash1, 0, 0));
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(verification_cache__contains__inserted__true_hit)
+{
+    verification_cache cache(42, salt);
+    cache.insert(hash1, 3, 7);
+    BOOST_REQUIRE(cache.contains(hash1, 3, 7));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(verification_cache__contains__distinct_key_parts__false)
+{
+    verification_cache cache(42, salt);
+    cache.insert(hash1, 3, 7);
+    BOOST_REQUIRE(!cache.contains(hash2, 3, 7));
+    BOOST_REQUIRE(!cache.contains(hash1, 4, 7));
+    BOOST_REQUIRE(!cache.contains(hash1, 3, 8));
+    BOOST_REQUIRE_EQUAL(cache.misses(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(verification_cache__insert__duplicate__not_added)
+{
+    verification_cache cache(42, salt);
+    cache.insert(hash1, 0, 0);
+    cache.insert(hash1, 0, 0);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(verification_cache__insert__zero_capacity__not_added)
+{
+    verification_cache cache(0, salt);
+    cache.insert(hash1, 0, 0);
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE(!cache.contains(hash1, 0, 0));
+}
+
+BOOST_AUTO_TEST_CASE(verification_cache__insert__full__evicts_oldest)
+{
+    verification_cache cache(2, salt);
+    cache.insert(hash1, 0, 0);
+    cache.insert(hash1, 1, 0);
+    cache.insert(hash1, 2, 0);
+    BOOST_REQUIRE_EQUAL(cache.size(), 2u);
+    BOOST_REQUIRE(!cache.contains(hash1, 0, 0));
+    BOOST_REQUIRE(cache.contains(hash1, 1, 0));
+    BOOST_REQUIRE(cache.contains(hash1, 2, 0));
+
+    cache.insert(hash1, 3, 0);
+    BOOST_REQUIRE_EQUAL(cache.size(), 2u);
+    BOOST_REQUIRE(!cache.contains(hash1, 1, 0));
+    BOOST_REQUIRE(cache.contains(hash1, 2, 0));
+    BOOST_REQUIRE(cache.contains(hash1, 3, 0));
+}
+
+BOOST_AUTO_TEST_CASE(verification_cache__clear__inserted__empty)
+{
+    verification_cache cache(42, salt);
+    cache.insert(hash1, 0, 0);
+    cache.insert(hash2, 0, 0);
+    cache.clear();
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE(!cache.contains(hash1, 0, 0));
+    BOOST_REQUIRE(!cache.contains(hash2, 0, 0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(fixed_uint256_tests)
+
+constexpr auto max256 = ~fixed_uint256{};
+constexpr auto word = fixed_uint256{ max_uint64 };
+constexpr auto power64 = fixed_uint256{ 1 } << 64;
+constexpr auto power128 = fixed_uint256{ 1 } << 128;
+
+// construction/conversion
+static_assert(is_zero(fixed_uint256{}));
+static_assert(fixed_uint256{ 42 } == 42u);
+static_assert(static_cast<uint32_t>(fixed_uint256{ 0x0000000100000002 }) == 2u);
+static_assert(fixed_uint256{ uint256_t{ 42 } } == 42u);
+static_assert(fixed_uint256{ uint256_t{ 1 } << 255 } == fixed_uint256{ 1 } << 255);
+static_assert(fixed_uint256{ 42 }.to_uintx() == 42u);
+static_assert(max256.to_uintx() == ~uint256_t{});
+static_assert(fixed_uint256{ one_hash } == one);
+static_assert(fixed_uint256{ one_hash }.to_bytes() == one_hash);
+static_assert(fixed_uint256{ null_hash }.to_bytes() == null_hash);
+
+// bit_width
+static_assert(fixed_uint256{}.bit_width() == 0u);
+static_assert(fixed_uint256{ 1 }.bit_width() == 1u);
+static_assert(power64.bit_width() == 65u);
+static_assert(max256.bit_width() == 256u);
+
+// comparison
+static_assert(power64 > word);
+static_assert(word < power64);
+static_assert(power128 > power64);
+static_assert(max256 >= max256);
+static_assert(fixed_uint256{} != one);
+
+// addition/subtraction (carry/borrow across words, wrapping)
+static_assert(word + 1u == power64);
+static_assert(power64 - 1u == word);
+static_assert(max256 + 1u == 0u);
+static_assert(fixed_uint256{} - 1u == max256);
+static_assert(++fixed_uint256{ word } == power64);
+static_assert(--fixed_uint256{ power64 } == word);
+
+// multiplication (carry across words, truncation)
+static_assert(word * word == power128 - power64 - power64 + 1u);
+static_assert(power128 * power128 == 0u);
+static_assert(max256 * max256 == 1u);
+
+// division/modulo
+static_assert(fixed_uint256{ 42 } / 0u == 0u);
+static_assert(fixed_uint256{ 42 } % 0u == 0u);
+static_assert(fixed_uint256{ 42 } / 43u == 0u);
+static_assert(fixed_uint256{ 42 } % 43u == 42u);
+static_assert(power128 / word == power64 + 1u);
+static_assert(power128 % word == 1u);
+static_assert(max256 / power128 == power128 - 1u);
+static_assert(max256 % power128 == power128 - 1u);
+static_assert(max256 / max256 == 1u);
+
+// shift
+static_assert(fixed_uint256{ 1 } << 256 == 0u);
+static_assert(max256 >> 256 == 0u);
+static_assert(max256 >> 255 == 1u);
+static_assert((power128 >> 63) == 2u * power64);
+static_assert((word << 4) == fixed_uint256{ word.data() } * 16u);
+
+// bitwise
+static_assert((max256 & word) == word);
+static_assert((power64 | word) == (power64 + word));
+static_assert((max256 ^ word) == max256 - word);
+
+// Deterministic pseudo-random 64 bit words (splitmix64).
+class generator
+{
+public:
+    uint64_t next() NOEXCEPT
+    {
+        auto value = (state_ += 0x9e3779b97f4a7c15);
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+        return value ^ (value >> 31);
+    }
+
+    // Random width exercises single word and multiple word divisors.
+    fixed_uint256 value() NOEXCEPT
+    {
+        const fixed_uint256 random
+        {
+            fixed_uint256::word_array{ next(), next(), next(), next() }
+        };
+
+        return random >> (next() % 256u);
+    }
+
+private:
+    uint64_t state_{};
+};
+
+BOOST_AUTO_TEST_CASE(fixed_uint256__arithmetic__random__matches_uint256_t)
+{
+    generator random{};
+    for (size_t round = 0; round < 2000; ++round)
+    {
+        const auto left = random.value();
+        const auto right = random.value();
+        const auto shift = random.next() % 300u;
+        const auto x = left.to_uintx();
+        const auto y = right.to_uintx();
+
+        BOOST_REQUIRE_EQUAL((left + right).to_uintx(), uint256_t(x + y));
+        BOOST_REQUIRE_EQUAL((left - right).to_uintx(), uint256_t(x - y));
+        BOOST_REQUIRE_EQUAL((left * right).to_uintx(), uint256_t(x * y));
+        BOOST_REQUIRE_EQUAL((left & right).to_uintx(), uint256_t(x & y));
+        BOOST_REQUIRE_EQUAL((left | right).to_uintx(), uint256_t(x | y));
+        BOOST_REQUIRE_EQUAL((left ^ right).to_uintx(), uint256_t(x ^ y));
+        BOOST_REQUIRE_EQUAL((~left).to_uintx(), uint256_t(~x));
+        BOOST_REQUIRE_EQUAL(left < right, x < y);
+        BOOST_REQUIRE_EQUAL(left == right, x == y);
+
+        if (shift < 256u)
+        {
+            BOOST_REQUIRE_EQUAL((left << shift).to_uintx(), uint256_t(x << shift));
+            BOOST_REQUIRE_EQUAL((left >> shift).to_uintx(), uint256_t(x >> shift));
+        }
+
+        if (!is_zero(y))
+        {
+            BOOST_REQUIRE_EQUAL((left / right).to_uintx(), uint256_t(x / y));
+            BOOST_REQUIRE_EQUAL((left % right).to_uintx(), uint256_t(x % y));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fixed_uint256__divide__aliased__expected)
+{
+    fixed_uint256 value{ max_uint64 };
+    fixed_uint256::divide(value, value, value, value);
+    BOOST_REQUIRE(is_zero(value));
+}
+
+BOOST_AUTO_TEST_CASE(fixed_uint256__bytes__hash__round_trip)
+{
+    const auto hash = base16_hash("00000000000000000008f8d1a5a2a1f1b1e1f2c3d4e5f60718293a4b5c6d7e8f");
+    const fixed_uint256 value{ hash };
+    BOOST_REQUIRE_EQUAL(value.to_uintx(), to_uintx(hash));
+    BOOST_REQUIRE_EQUAL(value.to_bytes(), hash);
+    BOOST_REQUIRE_EQUAL(fixed_uint256{ to_uintx(hash) }, value);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_uint256__insertion__decimal__expected)
+{
+    std::ostringstream stream{};
+    stream << (fixed_uint256{ 1 } << 64);
+    BOOST_REQUIRE_EQUAL(stream.str(), "18446744073709551616");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -602,4 +602,80 @@ BOOST_AUTO_TEST_CASE(base16__base16_hash__one_hash__expected)
     BOOST_REQUIRE_EQUAL(base16_hash("0000000000000000000000000000000000000000000000000000000000000001"), expected);
 }
 
+// vectorized
+
+// Scalar reference, independent of block conversion.
+static std::string scalar_encode(const data_chunk& data)
+{
+    std::string out{};
+    for (const auto byte: data)
+    {
+        out.push_back("0123456789abcdef"[byte >> 4]);
+        out.push_back("0123456789abcdef"[byte & 0x0f]);
+    }
+
+    return out;
+}
+
+static data_chunk sequence(size_t size)
+{
+    data_chunk out(size);
+    for (size_t index = 0; index < size; ++index)
+        out[index] = static_cast<uint8_t>(index * 37u + 11u);
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(base16__encode_base16__block_sizes__expected)
+{
+    for (size_t size = 0; size <= 131; ++size)
+    {
+        const auto data = sequence(size);
+        BOOST_REQUIRE_EQUAL(encode_base16(data), scalar_encode(data));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base16__decode_base16__block_sizes__round_trip)
+{
+    for (size_t size = 0; size <= 131; ++size)
+    {
+        data_chunk out{};
+        const auto data = sequence(size);
+        BOOST_REQUIRE(decode_base16(out, scalar_encode(data)));
+        BOOST_REQUIRE_EQUAL(out, data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base16__decode_base16__mixed_case_blocks__expected)
+{
+    const auto data = sequence(99);
+    auto text = scalar_encode(data);
+    for (size_t index = 0; index < text.size(); index += 3)
+        text[index] = static_cast<char>(std::toupper(text[index]));
+
+    data_chunk out{};
+    BOOST_REQUIRE(decode_base16(out, text));
+    BOOST_REQUIRE_EQUAL(out, data);
+}
+
+BOOST_AUTO_TEST_CASE(base16__decode_base16__invalid_character_any_position__false_unchanged)
+{
+    // 99 bytes: AVX2 block, SSE4.1 block, and scalar tail positions.
+    const auto data = sequence(99);
+    const auto text = scalar_encode(data);
+    const data_chunk expected{ 0x42 };
+
+    for (const auto bad: { 'g', 'G', '/', ':', '@', '`', ' ', '\xff' })
+    {
+        for (size_t index = 0; index < text.size(); ++index)
+        {
+            auto copy = text;
+            copy[index] = bad;
+            data_chunk out{ expected };
+            BOOST_REQUIRE(!decode_base16(out, copy));
+            BOOST_REQUIRE_EQUAL(out, expected);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
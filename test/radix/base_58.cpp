@@ -20,6 +20,43 @@
 
 BOOST_AUTO_TEST_SUITE(base_58_tests)
 
+// Byte-wise (quadratic) reference implementation, for comparison.
+std::string baseline_encode(const data_slice& unencoded)
+{
+    const std::string characters{ "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz" };
+    size_t leading = 0;
+    while (leading < unencoded.size() && is_zero(unencoded.data()[leading]))
+        ++leading;
+
+    data_chunk digits(add1((unencoded.size() - leading) * 138u / 100u));
+    for (auto byte = std::next(unencoded.begin(), leading); byte != unencoded.end(); ++byte)
+    {
+        size_t carry = *byte;
+        for (auto it = digits.rbegin(); it != digits.rend(); ++it)
+        {
+            carry += 256u * (*it);
+            *it = carry % 58u;
+            carry /= 58u;
+        }
+    }
+
+    auto it = std::find_if(digits.begin(), digits.end(), [](uint8_t digit) { return !is_zero(digit); });
+    std::string encoded(leading, '1');
+    for (; it != digits.end(); ++it)
+        encoded += characters[*it];
+
+    return encoded;
+}
+
+data_chunk random_data(size_t size, size_t seed)
+{
+    data_chunk out(size);
+    for (auto& byte: out)
+        byte = narrow_cast<uint8_t>((seed = hash_combine(42u, seed)));
+
+    return out;
+}
+
 void encode_decode_test(const std::string& base16, const std::string& encoded)
 {
     data_chunk data, decoded;
@@ -108,4 +145,74 @@ BOOST_AUTO_TEST_CASE(base58__decode_base58__array__expected)
     BOOST_REQUIRE_EQUAL(converted, expected);
 }
 
+BOOST_AUTO_TEST_CASE(base58__encode_base58__baseline_sizes__expected)
+{
+    // Covers stack sizes (including fixed 25/78/82), leading zeros, and heap.
+    for (size_t size = 0; size <= 200; ++size)
+    {
+        for (size_t zeros = 0; zeros <= std::min(size, 3_size); ++zeros)
+        {
+            auto data = random_data(size, size * 4u + zeros);
+            std::fill_n(data.begin(), zeros, 0x00_u8);
+
+            const auto encoded = encode_base58(data);
+            BOOST_REQUIRE_EQUAL(encoded, baseline_encode(data));
+
+            data_chunk decoded;
+            BOOST_REQUIRE(decode_base58(decoded, encoded));
+            BOOST_REQUIRE_EQUAL(decoded, data);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__invalid_character__false)
+{
+    data_chunk out{ 0x42 };
+    BOOST_REQUIRE(!decode_base58(out, "1NS17iag0jJgTHD1VXjvLCEnZuQ3rJDE9L"));
+    BOOST_REQUIRE(out.empty());
+    BOOST_REQUIRE(!decode_base58(out, "2g\x80"));
+    BOOST_REQUIRE(!decode_base58(out, "I"));
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__all_ones__zeros)
+{
+    data_chunk out;
+    BOOST_REQUIRE(decode_base58(out, "111"));
+    BOOST_REQUIRE_EQUAL(out, data_chunk(3, 0x00));
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+template <typename Function>
+size_t time_encode(const std::vector<data_chunk>& data, const Function& encode)
+{
+    size_t length = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& item: data)
+        length += encode(item).size();
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    BOOST_REQUIRE(!is_zero(length));
+    return sign_cast<size_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+BOOST_AUTO_TEST_CASE(base58__performance__baseline__faster)
+{
+    constexpr size_t rounds = 100000;
+    for (const auto size: { 25_size, 78_size, 82_size, 256_size })
+    {
+        std::vector<data_chunk> data{};
+        for (size_t round = 0; round < rounds; ++round)
+            data.push_back(random_data(size, round));
+
+        const auto limbs = time_encode(data, [](const data_chunk& item) { return encode_base58(item); });
+        const auto baseline = time_encode(data, [](const data_chunk& item) { return baseline_encode(item); });
+
+        std::cout << "base58," << size << "," << rounds << "," << limbs << "," << baseline << std::endl;
+        BOOST_CHECK_LT(limbs, baseline);
+    }
+}
+
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(props_writer_tests)
+
+// Equivalent of the props fixture below.
+static void write_fixture(props_writer& writer)
+{
+    writer.begin_object()
+        .name("a").null()
+        .name("b").boolean(true)
+        .name("c").number(-42)
+        .name("d").text("foo bar")
+        .name("e").begin_array("f")
+            .number(1)
+            .begin_object().name("g").text("baz").end_object()
+            .begin_array("h").boolean(false).text("x").end_array()
+        .end_array()
+        .name("i").begin_object().end_object()
+        .name("j").begin_array("k").end_array()
+    .end_object();
+}
+
+static std::string write_props(props::format format, bool flat)
+{
+    const object_props instance
+    {
+        { "a", props{} },
+        { "b", props{ props::truth::true_ } },
+        { "c", props{ -42 } },
+        { "d", props{ "foo bar" } },
+        { "e", array_props
+            {
+                "f",
+                {
+                    props{ 1 },
+                    object_props{ { "g", props{ "baz" } } },
+                    array_props
+                    {
+                        "h",
+                        {
+                            props{ props::truth::false_ },
+                            props{ "x" }
+                        }
+                    }
+                }
+            }
+        },
+        { "i", object_props{} },
+        { "j", array_props{ "k" } }
+    };
+
+    std::ostringstream stream;
+    instance.write(stream, format, flat);
+    return stream.str();
+}
+
+static std::string write_writer(props::format format, bool flat)
+{
+    std::ostringstream stream;
+    props_writer writer(stream, format, flat);
+    write_fixture(writer);
+    BOOST_REQUIRE(writer.is_complete());
+    return stream.str();
+}
+
+// props equivalence
+
+BOOST_AUTO_TEST_CASE(props_writer__fixture__json_flat__props_equivalent)
+{
+    BOOST_REQUIRE_EQUAL(write_writer(props::format::json, true),
+        write_props(props::format::json, true));
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__fixture__json_tree__props_equivalent)
+{
+    BOOST_REQUIRE_EQUAL(write_writer(props::format::json, false),
+        write_props(props::format::json, false));
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__fixture__info_flat__props_equivalent)
+{
+    BOOST_REQUIRE_EQUAL(write_writer(props::format::info, true),
+        write_props(props::format::info, true));
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__fixture__info_tree__props_equivalent)
+{
+    BOOST_REQUIRE_EQUAL(write_writer(props::format::info, false),
+        write_props(props::format::info, false));
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__fixture__xml_flat__props_equivalent)
+{
+    BOOST_REQUIRE_EQUAL(write_writer(props::format::xml, true),
+        write_props(props::format::xml, true));
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__fixture__xml_tree__props_equivalent)
+{
+    BOOST_REQUIRE_EQUAL(write_writer(props::format::xml, false),
+        write_props(props::format::xml, false));
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__fixture__json_flat__expected)
+{
+    BOOST_REQUIRE_EQUAL(write_writer(props::format::json, true),
+        "{\"a\":null,\"b\":true,\"c\":-42,\"d\":\"foo bar\","
+        "\"e\":[1,{\"g\":\"baz\"},[false,\"x\"]],\"i\":{},\"j\":[]}");
+}
+
+// number
+
+BOOST_AUTO_TEST_CASE(props_writer__number__limits__expected)
+{
+    constexpr auto power = power2<int64_t>(53u);
+    std::ostringstream stream;
+    props_writer writer(stream, props::format::json);
+    writer.begin_array().number(-power).number(sub1(sub1(power))).end_array();
+    BOOST_REQUIRE(writer.is_complete());
+    BOOST_REQUIRE_EQUAL(stream.str(),
+        "[-9007199254740992,9007199254740990]");
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__number__negative_overflow__stream_failure)
+{
+    constexpr auto power = power2<int64_t>(53u);
+    std::ostringstream stream;
+    props_writer writer(stream, props::format::json);
+    writer.number(-add1(power));
+    BOOST_REQUIRE(!stream);
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__number__positive_overflow__stream_failure)
+{
+    constexpr auto power = power2<uint64_t>(53u);
+    std::ostringstream stream;
+    props_writer writer(stream, props::format::json);
+    writer.number(sub1(power));
+    BOOST_REQUIRE(!stream);
+}
+
+// text
+
+BOOST_AUTO_TEST_CASE(props_writer__text__json_escapes__expected)
+{
+    std::ostringstream stream;
+    props_writer writer(stream, props::format::json);
+    writer.text(std::string{ "a\"b\\c\nd\te\x01" });
+    BOOST_REQUIRE(writer.is_complete());
+    BOOST_REQUIRE_EQUAL(stream.str(), "\"a\\\"b\\\\c\\nd\\te\\u0001\"");
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__text__xml_escapes__expected)
+{
+    std::ostringstream stream;
+    props_writer writer(stream, props::format::xml);
+    writer.begin_object().name("a").text("<b&c>").end_object();
+    BOOST_REQUIRE(writer.is_complete());
+    BOOST_REQUIRE_EQUAL(stream.str(), "<a>&lt;b&amp;c&gt;</a>");
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__text__info_contiguous__unquoted)
+{
+    std::ostringstream stream;
+    props_writer writer(stream, props::format::info);
+    writer.begin_array().text("foo").text("foo bar").end_array();
+    BOOST_REQUIRE(writer.is_complete());
+    BOOST_REQUIRE_EQUAL(stream.str(), "{foo \"foo bar\"}");
+}
+
+// balance
+
+BOOST_AUTO_TEST_CASE(props_writer__is_complete__open_object__false)
+{
+    std::ostringstream stream;
+    props_writer writer(stream, props::format::json);
+    writer.begin_object();
+    BOOST_REQUIRE(stream);
+    BOOST_REQUIRE(!writer.is_complete());
+}
+
+BOOST_AUTO_TEST_CASE(props_writer__end_array__within_object__stream_failure)
+{
+    std::ostringstream stream;
+    props_writer writer(stream, props::format::json);
+    writer.begin_object().end_array();
+    BOOST_REQUIRE(!stream);
+    BOOST_REQUIRE(!writer.is_complete());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,252 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(stream_tests)
+
+// Failed reads are populated with 0x00 by the reader.
+constexpr uint8_t pad = 0x00;
+
+// context
+
+BOOST_AUTO_TEST_CASE(span_reader__bool__empty__true)
+{
+    const data_chunk data{};
+    read::bytes::span reader(data);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(reader.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__is_exhausted__not_empty__false)
+{
+    const data_chunk data{ 0x2a };
+    read::bytes::span reader(data);
+    BOOST_REQUIRE(!reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__invalidate__not_empty__exhausted_invalid)
+{
+    const data_chunk data{ 0x2a };
+    read::bytes::span reader(data);
+    reader.invalidate();
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__peek_byte__not_empty__expected_not_advanced)
+{
+    const data_chunk data{ 0x2a, 0x42 };
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), 0x2a);
+    BOOST_REQUIRE_EQUAL(reader.get_read_position(), 0u);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__peek_byte__empty__pad_invalid)
+{
+    const data_chunk data{};
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), pad);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__skip_bytes__past_end__invalid)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    read::bytes::span reader(data);
+    reader.skip_bytes(2);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(reader.is_exhausted());
+    reader.skip_byte();
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__rewind_bytes__before_start__invalid)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    read::bytes::span reader(data);
+    reader.skip_byte();
+    reader.rewind_byte();
+    BOOST_REQUIRE(reader);
+    reader.rewind_byte();
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__set_position__invalid__valid_expected)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    read::bytes::span reader(data);
+    reader.skip_bytes(4);
+    BOOST_REQUIRE(!reader);
+    reader.set_position(2);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE_EQUAL(reader.get_read_position(), 2u);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 0x03);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__set_limit__read_past_limit__invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    read::bytes::span reader(data);
+    reader.set_limit(2);
+    BOOST_REQUIRE_EQUAL(reader.read_2_bytes_little_endian(), 0x0201u);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), pad);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__set_limit__reset__unlimited)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    read::bytes::span reader(data);
+    reader.set_limit(1);
+    reader.skip_byte();
+    reader.set_limit();
+    BOOST_REQUIRE_EQUAL(reader.read_2_bytes_big_endian(), 0x0203u);
+    BOOST_REQUIRE(reader);
+}
+
+// integers
+
+BOOST_AUTO_TEST_CASE(span_reader__read_endian__valid__expected)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x04, 0x01, 0x02, 0x03, 0x04 };
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_4_bytes_big_endian(), 0x01020304u);
+    BOOST_REQUIRE_EQUAL(reader.read_4_bytes_little_endian(), 0x04030201u);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__read_3_bytes__valid__expected)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x01, 0x02, 0x03 };
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_3_bytes_big_endian(), 0x010203u);
+    BOOST_REQUIRE_EQUAL(reader.read_3_bytes_little_endian(), 0x030201u);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__read_8_bytes_little_endian__underflow__zero_invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_8_bytes_little_endian(), 0u);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__read_variable__all_sizes__expected)
+{
+    const auto data = base16_chunk("2a" "fd3412" "fe78563412" "ffefcdab9078563412");
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x2au);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x1234u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x12345678u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x1234567890abcdefu);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__read_size__exceeds_limit__zero_invalid)
+{
+    const data_chunk data{ 0x2a };
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_size(41), 0u);
+    BOOST_REQUIRE(!reader);
+}
+
+// bytes
+
+BOOST_AUTO_TEST_CASE(span_reader__read_hash__valid__expected)
+{
+    const auto hash = base16_hash("0102030405060708091011121314151617181920212223242526272829303132");
+    read::bytes::span reader(hash);
+    BOOST_REQUIRE_EQUAL(reader.read_hash(), hash);
+    BOOST_REQUIRE(reader.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__read_reverse__valid__expected)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_reverse<3>(), (data_array<3>{ 0x03, 0x02, 0x01 }));
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__read_bytes__all__expected)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    read::bytes::span reader(data);
+    reader.skip_byte();
+    BOOST_REQUIRE_EQUAL(reader.read_bytes(), (data_chunk{ 0x02, 0x03 }));
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__read_bytes__size_underflow__padded_invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_bytes(4), data_chunk(4, pad));
+    BOOST_REQUIRE(!reader);
+    BOOST_REQUIRE(reader.read_bytes(1).empty());
+}
+
+// strings
+
+BOOST_AUTO_TEST_CASE(span_reader__read_string__valid__expected)
+{
+    const auto data = base16_chunk("03616263");
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_string(), "abc");
+    BOOST_REQUIRE(reader.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(span_reader__read_string_buffer__embedded_null__truncated_consumed)
+{
+    const auto data = base16_chunk("6162006364" "2a");
+    read::bytes::span reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_string_buffer(5), "ab");
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 0x2a);
+    BOOST_REQUIRE(reader);
+}
+
+// chain
+
+BOOST_AUTO_TEST_CASE(span_reader__chain_header__round_trip__expected)
+{
+    const chain::header header
+    {
+        10u,
+        base16_hash("000000000000000000000000000000000000000000000000000000000000abcd"),
+        base16_hash("fedcba0000000000000000000000000000000000000000000000000000000000"),
+        531234u,
+        6523454u,
+        68644u
+    };
+
+    const auto data = header.to_data();
+    read::bytes::span reader(data);
+    const chain::header copy(reader);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(copy.is_valid());
+    BOOST_REQUIRE(copy == header);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -287,4 +287,49 @@ BOOST_AUTO_TEST_CASE(payment_address__hash__compressed_point__expected)
     BOOST_REQUIRE_EQUAL(encode_base16(address.hash()), COMPRESSED_HASH);
 }
 
+// batch
+
+BOOST_AUTO_TEST_CASE(payment_address__encode__hashes__expected)
+{
+    short_hash compressed;
+    short_hash uncompressed;
+    BOOST_REQUIRE(decode_base16(compressed, COMPRESSED_HASH));
+    BOOST_REQUIRE(decode_base16(uncompressed, UNCOMPRESSED_HASH));
+
+    string_list out{ "stale", "stale", "stale" };
+    payment_address::encode(out, { compressed, uncompressed });
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out[0], ADDRESS_COMPRESSED);
+    BOOST_REQUIRE_EQUAL(out[1], ADDRESS_UNCOMPRESSED);
+}
+
+BOOST_AUTO_TEST_CASE(payment_address__encode__hashes_testnet__expected)
+{
+    short_hash uncompressed;
+    BOOST_REQUIRE(decode_base16(uncompressed, UNCOMPRESSED_HASH));
+
+    string_list out{};
+    payment_address::encode(out, { uncompressed }, payment_address::testnet_p2kh);
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out[0], ADDRESS_UNCOMPRESSED_TESTNET);
+}
+
+BOOST_AUTO_TEST_CASE(payment_address__decode__mixed__expected)
+{
+    payment_address::list out{};
+    payment_address::decode(out,
+    {
+        ADDRESS_SCRIPT,
+        "bogus",
+        ADDRESS_COMPRESSED_TESTNET
+    });
+
+    BOOST_REQUIRE_EQUAL(out.size(), 3u);
+    BOOST_REQUIRE(out[0]);
+    BOOST_REQUIRE(!out[1]);
+    BOOST_REQUIRE(out[2]);
+    BOOST_REQUIRE_EQUAL(out[0], payment_address(ADDRESS_SCRIPT));
+    BOOST_REQUIRE_EQUAL(out[2].encoded(), ADDRESS_COMPRESSED_TESTNET);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
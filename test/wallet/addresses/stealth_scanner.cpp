@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(stealth_scanner_tests)
+
+using namespace bc::system::chain;
+using namespace bc::system::wallet;
+
+#define MAIN_KEY "tprv8ctN3HAF9dCgX9ggdCwiZHa7c3UHuG2Ev4jgYWDhTHDUVWKKsg7znbr3vYtmCzVqcMQsjd9cSKsyKGaDvTAUMkw1UphETe1j8LcT21eWPkH"
+#define EPHEMERAL_PRIVATE "f91e673103863bbeb0ef1852cd8eade6b73ea55afc9b1873be62bf628eac072a"
+#define RECEIVER_PRIVATE "fc696c9f7143916f24977210c806101866c7fa13cc06982978d80518c91af2fb"
+
+static const auto version = payment_address::testnet_p2kh;
+static const binary sent_filter{ "10101010" };
+
+static stealth_receiver make_receiver(const binary& filter)
+{
+    const hd_private main_key(MAIN_KEY, hd_private::testnet);
+    const auto scan_key = main_key.derive_private(0 + hd_first_hardened_key);
+    const auto spend_key = main_key.derive_private(1 + hd_first_hardened_key);
+    return { scan_key.secret(), spend_key.secret(), filter, version };
+}
+
+// Metadata output at zero, unrelated output at one, payment at two.
+static transaction::cptr make_payment(const stealth_receiver& receiver)
+{
+    ec_secret ephemeral_private;
+    BOOST_REQUIRE(decode_base16(ephemeral_private, EPHEMERAL_PRIVATE));
+
+    const stealth_sender sender(ephemeral_private, receiver.stealth_address(),
+        data_chunk{ 0x42 }, sent_filter, version);
+    BOOST_REQUIRE(sender);
+
+    const auto pay = [](const short_hash& hash) NOEXCEPT
+    {
+        return script{ script::to_pay_key_hash_pattern(hash) };
+    };
+
+    return to_shared<transaction>(transaction
+    {
+        1,
+        inputs{},
+        outputs
+        {
+            { 0, sender.stealth_script() },
+            { 42, pay(null_short_hash) },
+            { 42, pay(sender.payment_address().hash()) }
+        },
+        0
+    });
+}
+
+BOOST_AUTO_TEST_CASE(stealth_scanner__scan__empty__empty)
+{
+    const stealth_scanner scanner({ make_receiver(sent_filter) });
+    BOOST_REQUIRE(scanner.scan(transaction_cptrs{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(stealth_scanner__scan__no_stealth_outputs__empty)
+{
+    const stealth_scanner scanner({ make_receiver(sent_filter) });
+    const transaction_cptrs txs
+    {
+        to_shared<transaction>(transaction{ 1, inputs{}, outputs{ { 42, script{} } }, 0 })
+    };
+
+    BOOST_REQUIRE(scanner.scan(txs).empty());
+}
+
+BOOST_AUTO_TEST_CASE(stealth_scanner__scan__matching_receiver__expected_match)
+{
+    const auto receiver = make_receiver(sent_filter);
+    const stealth_scanner scanner({ make_receiver(binary{ "01010101" }), receiver });
+    const auto tx = make_payment(receiver);
+    const transaction_cptrs txs
+    {
+        to_shared<transaction>(transaction{}),
+        tx
+    };
+
+    const auto matches = scanner.scan(txs);
+    BOOST_REQUIRE_EQUAL(matches.size(), 1u);
+
+    const auto& match = matches.front();
+    BOOST_REQUIRE_EQUAL(match.receiver, 1u);
+    BOOST_REQUIRE_EQUAL(match.transaction, 1u);
+    BOOST_REQUIRE_EQUAL(match.output, 2u);
+    BOOST_REQUIRE_EQUAL(encode_base16(match.secret), RECEIVER_PRIVATE);
+
+    ec_compressed ephemeral_public;
+    BOOST_REQUIRE(extract_ephemeral_key(ephemeral_public, tx->outputs_ptr()->front()->script()));
+    BOOST_REQUIRE_EQUAL(match.ephemeral_public, ephemeral_public);
+
+    ec_compressed spend_public;
+    BOOST_REQUIRE(secret_to_public(spend_public, match.secret));
+    BOOST_REQUIRE_EQUAL(match.address, payment_address(spend_public, version));
+}
+
+BOOST_AUTO_TEST_CASE(stealth_scanner__scan__mismatched_filter__empty)
+{
+    const stealth_scanner scanner({ make_receiver(binary{ "01010101" }) });
+    const transaction_cptrs txs{ make_payment(make_receiver(sent_filter)) };
+    BOOST_REQUIRE(scanner.scan(txs).empty());
+}
+
+BOOST_AUTO_TEST_CASE(stealth_scanner__scan__empty_filter__matches_any_prefix)
+{
+    const stealth_scanner scanner({ make_receiver(binary{}) });
+    const transaction_cptrs txs{ make_payment(make_receiver(sent_filter)) };
+    BOOST_REQUIRE_EQUAL(scanner.scan(txs).size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(stealth_scanner__scan__block__expected_match)
+{
+    const auto receiver = make_receiver(sent_filter);
+    const stealth_scanner scanner({ receiver });
+    const block instance{ header{}, transactions{ transaction{}, *make_payment(receiver) } };
+
+    const auto matches = scanner.scan(instance);
+    BOOST_REQUIRE_EQUAL(matches.size(), 1u);
+    BOOST_REQUIRE_EQUAL(matches.front().transaction, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1071,4 +1071,61 @@ BOOST_AUTO_TEST_CASE(witness_address__bip173__invalid_address10__payload_too_sho
     BOOST_REQUIRE(witness_address::parse_address(out1, out2, out3, "bc1gmk9yu") == result::payload_too_short);
 }
 
+// batch
+
+BOOST_AUTO_TEST_CASE(witness_address__encode__short_hashes__expected)
+{
+    string_list out{ "stale" };
+    const short_hashes hashes
+    {
+        base16_array("751e76e8199196d454941c45d1b3a323f1433bd6"),
+        null_short_hash
+    };
+
+    witness_address::encode(out, hashes);
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out[0], "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4");
+    BOOST_REQUIRE_EQUAL(out[1], witness_address(null_short_hash).encoded());
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__encode__hashes_testnet__expected)
+{
+    string_list out{};
+    const hashes hashes
+    {
+        base16_array("1863143c14c5166804bd19203356da136c985678cd4d27a1b8c6329604903262")
+    };
+
+    witness_address::encode(out, hashes, witness_address::testnet);
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out[0], "tb1qrp33g0q5c5txsp9arysrx4k6zdkfs4nce4xj0gdcccefvpysxf3q0sl5k7");
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__encode__invalid_prefix__empty_strings)
+{
+    string_list out{ "stale" };
+    witness_address::encode(out, short_hashes{ null_short_hash, null_short_hash }, "\x80");
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE(out[0].empty());
+    BOOST_REQUIRE(out[1].empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__decode__mixed__expected)
+{
+    witness_address::list out{};
+    witness_address::decode(out,
+    {
+        "BC1QW508D6QEJXTDG4Y5R3ZARVARY0C5XW7KV8F3T4",
+        "bc1gmk9yu",
+        "tb1qrp33g0q5c5txsp9arysrx4k6zdkfs4nce4xj0gdcccefvpysxf3q0sl5k7"
+    });
+
+    BOOST_REQUIRE_EQUAL(out.size(), 3u);
+    BOOST_REQUIRE(out[0]);
+    BOOST_REQUIRE(!out[1]);
+    BOOST_REQUIRE(out[2]);
+    BOOST_REQUIRE_EQUAL(out[0].program(), base16_chunk("751e76e8199196d454941c45d1b3a323f1433bd6"));
+    BOOST_REQUIRE(out[2].identifier() == type::version_0_p2sh);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(ec_affine_tests)
+
+const ec_compressed pointx = base16_array("0245dbb7e2cd3a5de19fde8d556fd567a036f9c377ecf69a9202aa4affce41c623");
+const ec_compressed pointy = base16_array("02cfc43e064c50cfd1896766ef70e7da82b16e8cfebd8d5dec618212d0db1e6d12");
+const ec_compressed sum_xy = base16_array("03332bf6821c7c0e1080efc131d2b745760a8245c0b91a05f13308ff8600d30525");
+const ec_secret secret = base16_array("8010b1bb119ad37d4b65a1022a314897b1b3614b345974332cb1b9582cf03536");
+
+BOOST_AUTO_TEST_CASE(ec_affine__construct__default__invalid)
+{
+    const ec_affine point{};
+    BOOST_REQUIRE(!point);
+    BOOST_REQUIRE_EQUAL(point.point(), null_ec_compressed);
+}
+
+BOOST_AUTO_TEST_CASE(ec_affine__construct__compressed__round_trip)
+{
+    const ec_affine point{ pointx };
+    BOOST_REQUIRE(point);
+    BOOST_REQUIRE_EQUAL(point.point(), pointx);
+}
+
+BOOST_AUTO_TEST_CASE(ec_affine__construct__invalid_compressed__invalid)
+{
+    const ec_affine point{ null_ec_compressed };
+    BOOST_REQUIRE(!point);
+}
+
+BOOST_AUTO_TEST_CASE(ec_affine__sum__two__expected)
+{
+    BOOST_REQUIRE_EQUAL((ec_affine{ pointx } + ec_affine{ pointy }).point(), sum_xy);
+    BOOST_REQUIRE_EQUAL(ec_affine::sum({ pointx, pointy }).point(), sum_xy);
+}
+
+BOOST_AUTO_TEST_CASE(ec_affine__sum__any_invalid__invalid)
+{
+    BOOST_REQUIRE(!ec_affine::sum({}));
+    BOOST_REQUIRE(!ec_affine::sum({ pointx, ec_affine{} }));
+}
+
+BOOST_AUTO_TEST_CASE(ec_affine__subtract__sum__expected)
+{
+    const ec_affine sum{ sum_xy };
+    BOOST_REQUIRE_EQUAL((sum - ec_affine{ pointy }).point(), pointx);
+}
+
+BOOST_AUTO_TEST_CASE(ec_affine__negate__self_sum__invalid)
+{
+    const ec_affine point{ pointx };
+    BOOST_REQUIRE(!(point + -point));
+}
+
+BOOST_AUTO_TEST_CASE(ec_affine__multiply__chained__same_as_ec_point)
+{
+    const ec_scalar scalar{ secret };
+    const auto expected = (ec_point{ pointx } * scalar + ec_point{ pointy }) * scalar;
+    const auto actual = (ec_affine{ pointx } * scalar + ec_affine{ pointy }) * scalar;
+    BOOST_REQUIRE(actual);
+    BOOST_REQUIRE_EQUAL(actual.point(), expected.point());
+    BOOST_REQUIRE(static_cast<ec_point>(actual) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(ec_affine__multiply__zero__invalid)
+{
+    BOOST_REQUIRE(!(ec_affine{ pointx } * ec_scalar{}));
+}
+
+BOOST_AUTO_TEST_CASE(ec_affine__from_scalar__secret__same_as_secret_to_public)
+{
+    ec_compressed expected;
+    BOOST_REQUIRE(secret_to_public(expected, secret));
+    BOOST_REQUIRE_EQUAL(ec_affine::from_scalar(secret).point(), expected);
+    BOOST_REQUIRE_EQUAL((ec_affine::generator() * secret).point(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(ec_affine__compress__list__expected)
+{
+    const auto points = ec_affine::compress({ pointx, ec_affine{}, pointy });
+    BOOST_REQUIRE_EQUAL(points.size(), 3u);
+    BOOST_REQUIRE_EQUAL(points[0], pointx);
+    BOOST_REQUIRE_EQUAL(points[1], null_ec_compressed);
+    BOOST_REQUIRE_EQUAL(points[2], pointy);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
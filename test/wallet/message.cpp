@@ -240,4 +240,47 @@ BOOST_AUTO_TEST_CASE(message__verify_message__electrum_incorrect_address__false)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(messages__verify_messages)
+
+BOOST_AUTO_TEST_CASE(message__verify_messages__empty__empty)
+{
+    BOOST_REQUIRE(verify_messages({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(message__verify_messages__mixed__expected_bitmap)
+{
+    const auto compressed = to_chunk(std::string("Compressed"));
+    const auto uncompressed = to_chunk(std::string("Uncompressed"));
+    const auto electrum = to_chunk(std::string("Nakomoto"));
+    const payment_address compressed_address(base16_array(SECRET));
+    const payment_address uncompressed_address({ base16_array(SECRET), 0x00, false });
+    const payment_address electrum_address("1PeChFbhxDD9NLbU21DfD55aQBC4ZTR3tE");
+    const payment_address wrong_address("1Em1SX7qQq1pTmByqLRafhL1ypx2V786tP");
+    const message_signature compressed_signature = base16_array(SIGNATURE_COMPRESSED);
+    const message_signature uncompressed_signature = base16_array(SIGNATURE_UNCOMPRESSED);
+    message_signature electrum_signature;
+    BOOST_REQUIRE(decode_base16(electrum_signature, ELECTRUM_SIGNATURE));
+
+    const signed_messages items
+    {
+        { compressed, compressed_address, compressed_signature },
+        { uncompressed, uncompressed_address, uncompressed_signature },
+        { electrum, electrum_address, electrum_signature },
+        { electrum, wrong_address, electrum_signature },
+        { uncompressed, compressed_address, compressed_signature },
+        { compressed, compressed_address, message_signature{} }
+    };
+
+    const auto bitmap = verify_messages(items);
+    BOOST_REQUIRE_EQUAL(bitmap.size(), items.size());
+    BOOST_REQUIRE(bitmap[0]);
+    BOOST_REQUIRE(bitmap[1]);
+    BOOST_REQUIRE(bitmap[2]);
+    BOOST_REQUIRE(!bitmap[3]);
+    BOOST_REQUIRE(!bitmap[4]);
+    BOOST_REQUIRE(!bitmap[5]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()
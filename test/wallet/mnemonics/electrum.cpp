@@ -336,6 +336,27 @@ BOOST_AUTO_TEST_CASE(electrum__grinder__prefix_none__not_found)
     BOOST_REQUIRE_EQUAL(result.iterations, limit);
 }
 
+BOOST_AUTO_TEST_CASE(electrum__grinder__limit_at_match__found)
+{
+    const data_chunk entropy(17, 0x00);
+    const auto find = prefix::two_factor_authentication;
+
+    // The match is found on the last permitted iteration (crosses batches).
+    const auto result = accessor::grinder(entropy, find, language::zh_Hans, 273);
+    BOOST_REQUIRE(electrum::is_prefix(result.words, find));
+    BOOST_REQUIRE_EQUAL(result.iterations, 273u);
+    BOOST_REQUIRE_EQUAL(result.entropy, accessor::grinder(entropy, find, language::zh_Hans, 1000).entropy);
+}
+
+BOOST_AUTO_TEST_CASE(electrum__grinder__limit_below_match__not_found)
+{
+    const data_chunk entropy(17, 0x00);
+    const auto find = prefix::two_factor_authentication;
+    const auto result = accessor::grinder(entropy, find, language::zh_Hans, 272);
+    BOOST_REQUIRE(result.entropy.empty());
+    BOOST_REQUIRE_EQUAL(result.iterations, 272u);
+}
+
 // seeder
 
 BOOST_AUTO_TEST_CASE(electrum__seeder__non_ascii_passphrase__expected)
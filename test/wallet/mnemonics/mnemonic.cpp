@@ -124,6 +124,71 @@ BOOST_AUTO_TEST_CASE(mnemonic__is_valid_word_count__valid__true)
     BOOST_CHECK(mnemonic::is_valid_word_count(24));
 }
 
+// decode
+
+BOOST_AUTO_TEST_CASE(mnemonic__decode__empty__empty)
+{
+    BOOST_CHECK(mnemonic::decode({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__decode__vectors_en__expected)
+{
+    mnemonic::word_lists lists{};
+    for (const auto& vector: vectors_en)
+        lists.push_back(vector.words());
+
+    const auto entropies = mnemonic::decode(lists);
+    BOOST_REQUIRE_EQUAL(entropies.size(), vectors_en.size());
+
+    for (size_t index = 0; index < vectors_en.size(); ++index)
+        BOOST_CHECK_EQUAL(entropies[index], vectors_en[index].entropy());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__decode__invalid__empty_in_order)
+{
+    auto bad_checksum = vectors_en[0].words();
+    bad_checksum.back() = bad_checksum.front();
+    const auto entropies = mnemonic::decode(
+    {
+        { "bogus" },
+        vectors_en[1].words(),
+        bad_checksum,
+        vectors_en[2].words()
+    }, language::en);
+
+    BOOST_REQUIRE_EQUAL(entropies.size(), 4u);
+    BOOST_CHECK(entropies[0].empty());
+    BOOST_CHECK_EQUAL(entropies[1], vectors_en[1].entropy());
+    BOOST_CHECK(entropies[2].empty());
+    BOOST_CHECK_EQUAL(entropies[3], vectors_en[2].entropy());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__decode__mismatched_language__empty)
+{
+    const auto entropies = mnemonic::decode({ vectors_en[0].words() },
+        language::es);
+
+    BOOST_REQUIRE_EQUAL(entropies.size(), 1u);
+    BOOST_CHECK(entropies.front().empty());
+}
+
+// validate
+
+BOOST_AUTO_TEST_CASE(mnemonic__validate__mixed__expected)
+{
+    const auto valid = mnemonic::validate(
+    {
+        vectors_en[3].words(),
+        { "bogus" },
+        vectors_en[4].words()
+    });
+
+    BOOST_REQUIRE_EQUAL(valid.size(), 3u);
+    BOOST_CHECK(valid[0]);
+    BOOST_CHECK(!valid[1]);
+    BOOST_CHECK(valid[2]);
+}
+
 #endif // PUBLIC_STATIC
 
 #ifdef PROTECTED_STATIC
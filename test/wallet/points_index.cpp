@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(points_index_tests)
+
+using namespace bc::system::wallet;
+using selection = points_value::selection;
+
+static points_value make_points(const std::vector<uint64_t>& values)
+{
+    points_value out{};
+    uint32_t index{};
+    for (const auto value: values)
+        out.points.emplace_back(chain::point{ null_hash, index++ }, value);
+
+    return out;
+}
+
+static std::vector<uint64_t> values(const points_value& points)
+{
+    std::vector<uint64_t> out{};
+    for (const auto& point: points.points)
+        out.push_back(point.value());
+
+    return out;
+}
+
+// construct
+
+BOOST_AUTO_TEST_CASE(points_index__construct__empty__zero_value)
+{
+    const points_index instance{ points_value{} };
+    BOOST_REQUIRE(instance.points().empty());
+    BOOST_REQUIRE_EQUAL(instance.value(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(points_index__construct__unsorted__descending)
+{
+    const points_index instance{ make_points({ 3, 10, 1, 7 }) };
+    const std::vector<uint64_t> expected{ 10, 7, 3, 1 };
+    BOOST_REQUIRE(values({ instance.points() }) == expected);
+    BOOST_REQUIRE_EQUAL(instance.value(), 21u);
+}
+
+// greedy
+
+BOOST_AUTO_TEST_CASE(points_index__greedy__insufficient__empty)
+{
+    points_value out{};
+    points_index{ make_points({ 1, 2, 3 }) }.select(out, 7, selection::greedy);
+    BOOST_REQUIRE(out.points.empty());
+}
+
+BOOST_AUTO_TEST_CASE(points_index__greedy__single_sufficient__smallest_sufficient)
+{
+    points_value out{};
+    points_index{ make_points({ 20, 1, 12, 9 }) }.select(out, 10, selection::greedy);
+    BOOST_REQUIRE(values(out) == std::vector<uint64_t>{ 12 });
+}
+
+BOOST_AUTO_TEST_CASE(points_index__greedy__none_sufficient__largest_first)
+{
+    points_value out{};
+    points_index{ make_points({ 1, 2, 3, 4, 5 }) }.select(out, 8, selection::greedy);
+    BOOST_REQUIRE((values(out) == std::vector<uint64_t>{ 5, 4 }));
+}
+
+BOOST_AUTO_TEST_CASE(points_index__greedy__same_as_points_value)
+{
+    const auto unspent = make_points({ 1, 2, 3, 4, 5, 6, 7 });
+    for (uint64_t minimum = 0; minimum <= 30; ++minimum)
+    {
+        points_value expected{};
+        points_value actual{};
+        points_value::select(expected, unspent, minimum, selection::greedy);
+        points_index{ unspent }.select(actual, minimum, selection::greedy);
+        BOOST_REQUIRE_EQUAL(actual.value(), expected.value());
+        BOOST_REQUIRE_EQUAL(actual.points.size(), expected.points.size());
+    }
+}
+
+// individual
+
+BOOST_AUTO_TEST_CASE(points_index__individual__mixed__sufficient_ascending)
+{
+    points_value out{};
+    points_index{ make_points({ 20, 1, 12, 9, 10 }) }.select(out, 10, selection::individual);
+    BOOST_REQUIRE((values(out) == std::vector<uint64_t>{ 10, 12, 20 }));
+}
+
+// branch_and_bound
+
+BOOST_AUTO_TEST_CASE(points_index__branch_and_bound__insufficient__empty)
+{
+    points_value out{};
+    points_index{ make_points({ 1, 2, 3 }) }.branch_and_bound(out, 7);
+    BOOST_REQUIRE(out.points.empty());
+}
+
+BOOST_AUTO_TEST_CASE(points_index__branch_and_bound__exact_set__exact_value)
+{
+    points_value out{};
+    points_index{ make_points({ 10, 7, 5, 3, 1 }) }.branch_and_bound(out, 8);
+    BOOST_REQUIRE_EQUAL(out.value(), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(points_index__branch_and_bound__no_exact_set__least_change)
+{
+    points_value out{};
+    points_index{ make_points({ 10, 6, 6 }) }.branch_and_bound(out, 11);
+    BOOST_REQUIRE((values(out) == std::vector<uint64_t>{ 6, 6 }));
+}
+
+BOOST_AUTO_TEST_CASE(points_index__branch_and_bound__no_tries__greedy)
+{
+    points_value out{};
+    points_index{ make_points({ 10, 6, 6 }) }.branch_and_bound(out, 11, 0);
+    BOOST_REQUIRE((values(out) == std::vector<uint64_t>{ 10, 6 }));
+}
+
+BOOST_AUTO_TEST_CASE(points_index__branch_and_bound__points_value_select__same)
+{
+    points_value out{};
+    points_value::select(out, make_points({ 6, 10, 6 }), 11, selection::branch_and_bound);
+    BOOST_REQUIRE_EQUAL(out.value(), 12u);
+}
+
+// knapsack
+
+BOOST_AUTO_TEST_CASE(points_index__knapsack__insufficient__empty)
+{
+    points_value out{};
+    points_index{ make_points({ 1, 2, 3 }) }.knapsack(out, 7);
+    BOOST_REQUIRE(out.points.empty());
+}
+
+BOOST_AUTO_TEST_CASE(points_index__knapsack__exact_single__single)
+{
+    points_value out{};
+    points_index{ make_points({ 5, 8, 3 }) }.knapsack(out, 8);
+    BOOST_REQUIRE(values(out) == std::vector<uint64_t>{ 8 });
+}
+
+BOOST_AUTO_TEST_CASE(points_index__knapsack__insufficient_lesser__smallest_sufficient)
+{
+    points_value out{};
+    points_index{ make_points({ 30, 20, 3, 4 }) }.knapsack(out, 10);
+    BOOST_REQUIRE(values(out) == std::vector<uint64_t>{ 20 });
+}
+
+BOOST_AUTO_TEST_CASE(points_index__knapsack__lesser_set__lesser_set)
+{
+    points_value out{};
+    points_index{ make_points({ 100, 6, 5, 4 }) }.knapsack(out, 10);
+    BOOST_REQUIRE_EQUAL(out.value(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(points_index__knapsack__equal_single__single)
+{
+    points_value out{};
+    points_index{ make_points({ 11, 6, 5 }) }.knapsack(out, 10);
+    BOOST_REQUIRE(values(out) == std::vector<uint64_t>{ 11 });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -78,4 +78,24 @@ BOOST_AUTO_TEST_CASE(points_value__value__multiple_point_values_clear__zero)
     BOOST_REQUIRE_EQUAL(instance.value(), 0u);
 }
 
+BOOST_AUTO_TEST_CASE(points_value__select__greedy_none_sufficient__largest_first)
+{
+    const points_value unspent
+    {
+        {
+            { { null_hash, 0u }, 1u },
+            { { null_hash, 1u }, 5u },
+            { { null_hash, 2u }, 3u },
+            { { null_hash, 3u }, 4u },
+            { { null_hash, 4u }, 2u }
+        }
+    };
+
+    points_value out{};
+    points_value::select(out, unspent, 8u);
+    BOOST_REQUIRE_EQUAL(out.points.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out.points[0].value(), 5u);
+    BOOST_REQUIRE_EQUAL(out.points[1].value(), 4u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(perfect_hash_tests)
+
+using namespace bc::system::words;
+
+template <size_t Size>
+static bool round_trips(const std::array<const char*, Size>& words)
+{
+    const perfect_hash<Size> hash(words);
+    if (!hash.perfect())
+        return false;
+
+    for (size_t index = 0; index < Size; ++index)
+        if (hash.index(words[index]) != static_cast<int32_t>(index))
+            return false;
+
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__index__empty__negative)
+{
+    const std::array<const char*, 0> words{};
+    const perfect_hash<0> hash(words);
+    BOOST_REQUIRE(hash.perfect());
+    BOOST_REQUIRE_EQUAL(hash.index("abandon"), -1);
+    BOOST_REQUIRE_EQUAL(hash.index(""), -1);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__index__unsorted__expected)
+{
+    const std::array<const char*, 4> words{ "zebra", "apple", "mango", "kiwi" };
+    const perfect_hash<4> hash(words);
+    BOOST_REQUIRE(hash.perfect());
+    BOOST_REQUIRE_EQUAL(hash.index("zebra"), 0);
+    BOOST_REQUIRE_EQUAL(hash.index("apple"), 1);
+    BOOST_REQUIRE_EQUAL(hash.index("mango"), 2);
+    BOOST_REQUIRE_EQUAL(hash.index("kiwi"), 3);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__index__missing__negative)
+{
+    const std::array<const char*, 3> words{ "abandon", "ability", "able" };
+    const perfect_hash<3> hash(words);
+    BOOST_REQUIRE_EQUAL(hash.index("abandons"), -1);
+    BOOST_REQUIRE_EQUAL(hash.index("abl"), -1);
+    BOOST_REQUIRE_EQUAL(hash.index("bogus"), -1);
+    BOOST_REQUIRE_EQUAL(hash.index(""), -1);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__index__duplicates__linear_first)
+{
+    const std::array<const char*, 3> words{ "abandon", "able", "abandon" };
+    const perfect_hash<3> hash(words);
+    BOOST_REQUIRE(!hash.perfect());
+    BOOST_REQUIRE_EQUAL(hash.index("abandon"), 0);
+    BOOST_REQUIRE_EQUAL(hash.index("able"), 1);
+    BOOST_REQUIRE_EQUAL(hash.index("bogus"), -1);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__index__mnemonic_catalogs__round_trip)
+{
+    BOOST_REQUIRE(round_trips(mnemonic::en.word));
+    BOOST_REQUIRE(round_trips(mnemonic::es.word));
+    BOOST_REQUIRE(round_trips(mnemonic::it.word));
+    BOOST_REQUIRE(round_trips(mnemonic::fr.word));
+    BOOST_REQUIRE(round_trips(mnemonic::cs.word));
+    BOOST_REQUIRE(round_trips(mnemonic::pt.word));
+    BOOST_REQUIRE(round_trips(mnemonic::ja.word));
+    BOOST_REQUIRE(round_trips(mnemonic::ko.word));
+    BOOST_REQUIRE(round_trips(mnemonic::zh_Hans.word));
+    BOOST_REQUIRE(round_trips(mnemonic::zh_Hant.word));
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__index__electrum_catalogs__round_trip)
+{
+    BOOST_REQUIRE(round_trips(electrum::en.word));
+    BOOST_REQUIRE(round_trips(electrum::es.word));
+    BOOST_REQUIRE(round_trips(electrum::ja.word));
+    BOOST_REQUIRE(round_trips(electrum::pt.word));
+    BOOST_REQUIRE(round_trips(electrum::zh_Hans.word));
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__index__electrum_v1_catalogs__round_trip)
+{
+    BOOST_REQUIRE(round_trips(electrum_v1::en.word));
+    BOOST_REQUIRE(round_trips(electrum_v1::pt.word));
+}
+
+BOOST_AUTO_TEST_SUITE_END()